@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../libcompat.a"
+  "../../libcompat.pdb"
+  "CMakeFiles/compat.dir/string.c.o"
+  "CMakeFiles/compat.dir/string.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/compat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
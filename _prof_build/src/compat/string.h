@@ -0,0 +1,61 @@
+/**
+ * @file
+ *
+ * @author OmniBlade
+ *
+ * @brief Some extra string manipulation functions not present in all standard CRTs
+ *
+ * @copyright StdCompat is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#ifndef STRINGCOMPAT_H
+#define STRINGCOMPAT_H
+
+/* #undef HAVE_STRTRIM */
+/* #undef HAVE_STRLWR */
+/* #undef HAVE_STRUPR */
+/* #undef HAVE_STRLCAT */
+/* #undef HAVE_STRLCPY */
+
+#include <ctype.h>
+
+/* Vodoo to extend platform string.h file. */
+#ifdef _MSC_VER
+#include <../ucrt/string.h>
+#else
+#include_next <string.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef HAVE_STRTRIM
+char *strtrim(char *str);
+#endif
+
+#ifndef HAVE_STRLWR
+char *strlwr(char *str);
+#endif
+
+#ifndef HAVE_STRUPR
+char *strupr(char *str);
+#endif
+
+#ifndef HAVE_STRLCAT
+size_t strlcat(char *dst, const char *src, size_t dsize);
+#endif
+
+#ifndef HAVE_STRLCPY
+size_t strlcpy(char *dst, const char *src, size_t dsize);
+#endif
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../../git-state-hash"
+  "CMakeFiles/check_git"
+  "gitinfo.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/check_git.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
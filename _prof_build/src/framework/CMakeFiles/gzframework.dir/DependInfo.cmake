@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_prof_build/src/framework/gitinfo.c" "src/framework/CMakeFiles/gzframework.dir/gitinfo.c.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/gitinfo.c.o.d"
+  "/root/repo/src/framework/gimexstd.cpp" "src/framework/CMakeFiles/gzframework.dir/gimexstd.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/gimexstd.cpp.o.d"
+  "/root/repo/src/framework/rz/rzatom.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzatom.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzatom.cpp.o.d"
+  "/root/repo/src/framework/rz/rzcasefold.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzcasefold.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzcasefold.cpp.o.d"
+  "/root/repo/src/framework/rz/rzcmdline.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzcmdline.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzcmdline.cpp.o.d"
+  "/root/repo/src/framework/rz/rzcomdlldirector.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzcomdlldirector.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzcomdlldirector.cpp.o.d"
+  "/root/repo/src/framework/rz/rzcriticalsection_posix.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzcriticalsection_posix.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzcriticalsection_posix.cpp.o.d"
+  "/root/repo/src/framework/rz/rzdate.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzdate.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzdate.cpp.o.d"
+  "/root/repo/src/framework/rz/rzfastalloc.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzfastalloc.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzfastalloc.cpp.o.d"
+  "/root/repo/src/framework/rz/rzformat.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzformat.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzformat.cpp.o.d"
+  "/root/repo/src/framework/rz/rzhash.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzhash.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzhash.cpp.o.d"
+  "/root/repo/src/framework/rz/rzlockprofiler.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzlockprofiler.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzlockprofiler.cpp.o.d"
+  "/root/repo/src/framework/rz/rzrandom.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzrandom.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzrandom.cpp.o.d"
+  "/root/repo/src/framework/rz/rzrandomservice.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzrandomservice.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzrandomservice.cpp.o.d"
+  "/root/repo/src/framework/rz/rzrandomsuper.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzrandomsuper.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzrandomsuper.cpp.o.d"
+  "/root/repo/src/framework/rz/rzreadwritelock_posix.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzreadwritelock_posix.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzreadwritelock_posix.cpp.o.d"
+  "/root/repo/src/framework/rz/rzscopedarena.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzscopedarena.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzscopedarena.cpp.o.d"
+  "/root/repo/src/framework/rz/rzstring.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzstring.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzstring.cpp.o.d"
+  "/root/repo/src/framework/rz/rzthreadsafe.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzthreadsafe.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzthreadsafe.cpp.o.d"
+  "/root/repo/src/framework/rz/rztime.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rztime.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rztime.cpp.o.d"
+  "/root/repo/src/framework/rz/rzunicodestring.cpp" "src/framework/CMakeFiles/gzframework.dir/rz/rzunicodestring.cpp.o" "gcc" "src/framework/CMakeFiles/gzframework.dir/rz/rzunicodestring.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/src/compat/CMakeFiles/compat.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/src/gimex/CMakeFiles/gimex.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
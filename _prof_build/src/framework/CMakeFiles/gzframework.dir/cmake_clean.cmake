@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "../../libgzframework.a"
+  "../../libgzframework.pdb"
+  "CMakeFiles/gzframework.dir/gimexstd.cpp.o"
+  "CMakeFiles/gzframework.dir/gimexstd.cpp.o.d"
+  "CMakeFiles/gzframework.dir/gitinfo.c.o"
+  "CMakeFiles/gzframework.dir/gitinfo.c.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzatom.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzatom.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzcasefold.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzcasefold.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzcmdline.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzcmdline.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzcomdlldirector.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzcomdlldirector.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzcriticalsection_posix.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzcriticalsection_posix.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzdate.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzdate.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzfastalloc.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzfastalloc.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzformat.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzformat.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzhash.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzhash.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzlockprofiler.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzlockprofiler.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzrandom.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzrandom.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzrandomservice.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzrandomservice.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzrandomsuper.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzrandomsuper.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzreadwritelock_posix.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzreadwritelock_posix.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzscopedarena.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzscopedarena.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzstring.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzstring.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzthreadsafe.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzthreadsafe.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rztime.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rztime.cpp.o.d"
+  "CMakeFiles/gzframework.dir/rz/rzunicodestring.cpp.o"
+  "CMakeFiles/gzframework.dir/rz/rzunicodestring.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/gzframework.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+/**
+ * @file
+ *
+ * @brief Embedded git information.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "gitinfo.h"
+
+const char GitSHA1[] = "68de42bf5fb2567d378eadb2118d3f7ac6de97a7";
+const char GitShortSHA1[] = "68de42b";
+const char GitCommitDate[] = "2026-10-18 20:59:55 +0000";
+const char GitCommitAuthorName[] = "agent";
+const char GitTag[] = "";
+time_t GitCommitTimeStamp = 1792357195;
+bool GitUncommittedChanges = true;
+bool GitHaveInfo = false;
+int GitRevision = 29;
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/game/main.cpp" "src/game/CMakeFiles/marionetas.dir/main.cpp.o" "gcc" "src/game/CMakeFiles/marionetas.dir/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/src/framework/CMakeFiles/gzframework.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/src/gimex/CMakeFiles/gimex.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/src/compat/CMakeFiles/compat.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
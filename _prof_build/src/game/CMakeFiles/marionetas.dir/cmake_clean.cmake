@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../marionetas"
+  "../../marionetas.pdb"
+  "CMakeFiles/marionetas.dir/main.cpp.o"
+  "CMakeFiles/marionetas.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/marionetas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/gimex/src/bitmapgimex.c" "src/gimex/CMakeFiles/gimex.dir/src/bitmapgimex.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/bitmapgimex.c.o.d"
+  "/root/repo/src/gimex/src/gfuncs.c" "src/gimex/CMakeFiles/gimex.dir/src/gfuncs.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/gfuncs.c.o.d"
+  "/root/repo/src/gimex/src/gimex.c" "src/gimex/CMakeFiles/gimex.dir/src/gimex.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/gimex.c.o.d"
+  "/root/repo/src/gimex/src/gimexindex.c" "src/gimex/CMakeFiles/gimex.dir/src/gimexindex.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/gimexindex.c.o.d"
+  "/root/repo/src/gimex/src/gpixel.c" "src/gimex/CMakeFiles/gimex.dir/src/gpixel.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/gpixel.c.o.d"
+  "/root/repo/src/gimex/src/jpeggimex.c" "src/gimex/CMakeFiles/gimex.dir/src/jpeggimex.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/jpeggimex.c.o.d"
+  "/root/repo/src/gimex/src/nullgimex.c" "src/gimex/CMakeFiles/gimex.dir/src/nullgimex.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/nullgimex.c.o.d"
+  "/root/repo/src/gimex/src/pnggimex.c" "src/gimex/CMakeFiles/gimex.dir/src/pnggimex.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/pnggimex.c.o.d"
+  "/root/repo/src/gimex/src/shapefile.c" "src/gimex/CMakeFiles/gimex.dir/src/shapefile.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/shapefile.c.o.d"
+  "/root/repo/src/gimex/src/shpgimex.c" "src/gimex/CMakeFiles/gimex.dir/src/shpgimex.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/shpgimex.c.o.d"
+  "/root/repo/src/gimex/src/targagimex.c" "src/gimex/CMakeFiles/gimex.dir/src/targagimex.c.o" "gcc" "src/gimex/CMakeFiles/gimex.dir/src/targagimex.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/src/compat/CMakeFiles/compat.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../libgimex.a"
+  "../../libgimex.pdb"
+  "CMakeFiles/gimex.dir/src/bitmapgimex.c.o"
+  "CMakeFiles/gimex.dir/src/bitmapgimex.c.o.d"
+  "CMakeFiles/gimex.dir/src/gfuncs.c.o"
+  "CMakeFiles/gimex.dir/src/gfuncs.c.o.d"
+  "CMakeFiles/gimex.dir/src/gimex.c.o"
+  "CMakeFiles/gimex.dir/src/gimex.c.o.d"
+  "CMakeFiles/gimex.dir/src/gimexindex.c.o"
+  "CMakeFiles/gimex.dir/src/gimexindex.c.o.d"
+  "CMakeFiles/gimex.dir/src/gpixel.c.o"
+  "CMakeFiles/gimex.dir/src/gpixel.c.o.d"
+  "CMakeFiles/gimex.dir/src/jpeggimex.c.o"
+  "CMakeFiles/gimex.dir/src/jpeggimex.c.o.d"
+  "CMakeFiles/gimex.dir/src/nullgimex.c.o"
+  "CMakeFiles/gimex.dir/src/nullgimex.c.o.d"
+  "CMakeFiles/gimex.dir/src/pnggimex.c.o"
+  "CMakeFiles/gimex.dir/src/pnggimex.c.o.d"
+  "CMakeFiles/gimex.dir/src/shapefile.c.o"
+  "CMakeFiles/gimex.dir/src/shapefile.c.o.d"
+  "CMakeFiles/gimex.dir/src/shpgimex.c.o"
+  "CMakeFiles/gimex.dir/src/shpgimex.c.o.d"
+  "CMakeFiles/gimex.dir/src/targagimex.c.o"
+  "CMakeFiles/gimex.dir/src/targagimex.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gimex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
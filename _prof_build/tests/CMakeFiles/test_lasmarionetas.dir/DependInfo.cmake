@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/test_rzatom.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzatom.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzatom.cpp.o.d"
+  "/root/repo/tests/test_rzcmdline.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzcmdline.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzcmdline.cpp.o.d"
+  "/root/repo/tests/test_rzcriticalsection.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzcriticalsection.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzcriticalsection.cpp.o.d"
+  "/root/repo/tests/test_rzfastalloc.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzfastalloc.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzfastalloc.cpp.o.d"
+  "/root/repo/tests/test_rzhash.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzhash.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzhash.cpp.o.d"
+  "/root/repo/tests/test_rzlockprofiler.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzlockprofiler.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzlockprofiler.cpp.o.d"
+  "/root/repo/tests/test_rzrandom.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzrandom.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzrandom.cpp.o.d"
+  "/root/repo/tests/test_rzrandomservice.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzrandomservice.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzrandomservice.cpp.o.d"
+  "/root/repo/tests/test_rzreadwritelock.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzreadwritelock.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzreadwritelock.cpp.o.d"
+  "/root/repo/tests/test_rzrefcount.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzrefcount.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzrefcount.cpp.o.d"
+  "/root/repo/tests/test_rzscopedarena.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzscopedarena.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzscopedarena.cpp.o.d"
+  "/root/repo/tests/test_rzstring.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzstring.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzstring.cpp.o.d"
+  "/root/repo/tests/test_rzthreadsafe.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzthreadsafe.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzthreadsafe.cpp.o.d"
+  "/root/repo/tests/test_rzunicodestring.cpp" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzunicodestring.cpp.o" "gcc" "tests/CMakeFiles/test_lasmarionetas.dir/test_rzunicodestring.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_prof_build/src/framework/CMakeFiles/gzframework.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/src/gimex/CMakeFiles/gimex.dir/DependInfo.cmake"
+  "/root/repo/_prof_build/src/compat/CMakeFiles/compat.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,38 @@
+file(REMOVE_RECURSE
+  "../test_lasmarionetas"
+  "../test_lasmarionetas.pdb"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzatom.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzatom.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzcmdline.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzcmdline.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzcriticalsection.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzcriticalsection.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzfastalloc.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzfastalloc.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzhash.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzhash.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzlockprofiler.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzlockprofiler.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzrandom.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzrandom.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzrandomservice.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzrandomservice.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzreadwritelock.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzreadwritelock.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzrefcount.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzrefcount.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzscopedarena.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzscopedarena.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzstring.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzstring.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzthreadsafe.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzthreadsafe.cpp.o.d"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzunicodestring.cpp.o"
+  "CMakeFiles/test_lasmarionetas.dir/test_rzunicodestring.cpp.o.d"
+  "test_lasmarionetas[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_lasmarionetas.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
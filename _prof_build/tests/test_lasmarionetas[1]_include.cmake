@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_prof_build/tests/test_lasmarionetas[1]_tests.cmake")
+  include("/root/repo/_prof_build/tests/test_lasmarionetas[1]_tests.cmake")
+else()
+  add_test(test_lasmarionetas_NOT_BUILT test_lasmarionetas_NOT_BUILT)
+endif()
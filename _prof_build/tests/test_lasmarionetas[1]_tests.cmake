@@ -0,0 +1,89 @@
+add_test([=[atom.intern]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=atom.intern]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[atom.intern]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[atom.threads]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=atom.threads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[atom.threads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[commandline.cmdline_parse]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=commandline.cmdline_parse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[commandline.cmdline_parse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[criticalsection.recursion]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=criticalsection.recursion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[criticalsection.recursion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[criticalsection.exclusion]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=criticalsection.exclusion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[criticalsection.exclusion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[criticalsection.contention]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=criticalsection.contention]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[criticalsection.contention]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[fastalloc.alloc_free]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=fastalloc.alloc_free]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[fastalloc.alloc_free]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[fastalloc.realloc]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=fastalloc.realloc]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[fastalloc.realloc]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[fastalloc.threads]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=fastalloc.threads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[fastalloc.threads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[fastalloc.sized_free]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=fastalloc.sized_free]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[fastalloc.sized_free]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[fastalloc.tracking]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=fastalloc.tracking]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[fastalloc.tracking]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hash.case_folding]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=hash.case_folding]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hash.case_folding]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[hash.containers]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=hash.containers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[hash.containers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[lockprofiler.statistics]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=lockprofiler.statistics]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[lockprofiler.statistics]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.lcg_rng]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.lcg_rng]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.lcg_rng]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.mersenne_rng]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.mersenne_rng]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.mersenne_rng]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.mersenne_reload]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.mersenne_reload]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.mersenne_reload]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.mersenne_reload_seeds]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.mersenne_reload_seeds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.mersenne_reload_seeds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.mersenne_fill]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.mersenne_fill]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.mersenne_fill]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.lcg_jump]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.lcg_jump]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.lcg_jump]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.mersenne_jump]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.mersenne_jump]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.mersenne_jump]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.bounded]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.bounded]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.bounded]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.double53]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.double53]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.double53]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[random.ziggurat]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=random.ziggurat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[random.ziggurat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[randomservice.master_seed]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=randomservice.master_seed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[randomservice.master_seed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[randomservice.thread_streams]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=randomservice.thread_streams]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[randomservice.thread_streams]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[randomservice.service]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=randomservice.service]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[randomservice.service]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[readwritelock.shared_readers]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=readwritelock.shared_readers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[readwritelock.shared_readers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[readwritelock.writer_preference]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=readwritelock.writer_preference]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[readwritelock.writer_preference]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[readwritelock.exclusion]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=readwritelock.exclusion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[readwritelock.exclusion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[refcount.counting]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=refcount.counting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[refcount.counting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[refcount.shared_string]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=refcount.shared_string]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[refcount.shared_string]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[scopedarena.allocate_reset]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=scopedarena.allocate_reset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[scopedarena.allocate_reset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[scopedarena.containers]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=scopedarena.containers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[scopedarena.containers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[string.case_compare]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=string.case_compare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[string.case_compare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[string.case_find]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=string.case_find]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[string.case_find]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[string.move]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=string.move]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[string.move]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[string.sprintf]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=string.sprintf]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[string.sprintf]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[string.format]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=string.format]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[string.format]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[threadsafe.exchange]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=threadsafe.exchange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[threadsafe.exchange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[threadsafe.atomic_operations]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=threadsafe.atomic_operations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[threadsafe.atomic_operations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[threadsafe.atomic_threads]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=threadsafe.atomic_threads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[threadsafe.atomic_threads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[unicodestring.transcode]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=unicodestring.transcode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[unicodestring.transcode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[unicodestring.case_compare]=]  /root/repo/_prof_build/test_lasmarionetas [==[--gtest_filter=unicodestring.case_compare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[unicodestring.case_compare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_prof_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test_lasmarionetas_TESTS atom.intern atom.threads commandline.cmdline_parse criticalsection.recursion criticalsection.exclusion criticalsection.contention fastalloc.alloc_free fastalloc.realloc fastalloc.threads fastalloc.sized_free fastalloc.tracking hash.case_folding hash.containers lockprofiler.statistics random.lcg_rng random.mersenne_rng random.mersenne_reload random.mersenne_reload_seeds random.mersenne_fill random.lcg_jump random.mersenne_jump random.bounded random.double53 random.ziggurat randomservice.master_seed randomservice.thread_streams randomservice.service readwritelock.shared_readers readwritelock.writer_preference readwritelock.exclusion refcount.counting refcount.shared_string scopedarena.allocate_reset scopedarena.containers string.case_compare string.case_find string.move string.sprintf string.format threadsafe.exchange threadsafe.atomic_operations threadsafe.atomic_threads unicodestring.transcode unicodestring.case_compare)
@@ -0,0 +1,69 @@
+/**
+ * @file
+ *
+ * @author OmniBlade
+ *
+ * @brief Runtime detection of x86 SIMD extensions for selecting vectorised code paths.
+ *
+ * @copyright Compat is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#ifndef STDCOMPAT_CPUFEATURES_H
+#define STDCOMPAT_CPUFEATURES_H
+
+#if defined __x86_64__ || defined __i386__ || defined _M_X64 || defined _M_IX86
+#define HAVE_X86_SIMD 1
+#include <immintrin.h>
+#if defined _MSC_VER && !defined __clang__
+#include <intrin.h>
+#endif
+#endif
+
+/* Lets a single function use instructions beyond the baseline the translation unit is compiled for */
+#if defined __GNUC__ || defined __clang__
+#define __target_attr(x) __attribute__((target(x)))
+#else
+#define __target_attr(x)
+#endif
+
+#define CPU_FEATURE_SSE2 0x1
+#define CPU_FEATURE_SSSE3 0x2
+#define CPU_FEATURE_SSE41 0x4
+#define CPU_FEATURE_AVX2 0x8
+
+/* Callers on hot paths should cache the result, on MSVC this executes cpuid every time */
+static inline unsigned cpu_features(void)
+{
+    unsigned features = 0;
+#if defined HAVE_X86_SIMD && (defined __GNUC__ || defined __clang__)
+    __builtin_cpu_init();
+    features |= __builtin_cpu_supports("sse2") ? CPU_FEATURE_SSE2 : 0;
+    features |= __builtin_cpu_supports("ssse3") ? CPU_FEATURE_SSSE3 : 0;
+    features |= __builtin_cpu_supports("sse4.1") ? CPU_FEATURE_SSE41 : 0;
+    features |= __builtin_cpu_supports("avx2") ? CPU_FEATURE_AVX2 : 0;
+#elif defined HAVE_X86_SIMD && defined _MSC_VER
+    int regs[4];
+    __cpuid(regs, 0);
+
+    if (regs[0] >= 1) {
+        int max_leaf = regs[0];
+        __cpuid(regs, 1);
+        features |= (regs[3] & (1 << 26)) ? CPU_FEATURE_SSE2 : 0;
+        features |= (regs[2] & (1 << 9)) ? CPU_FEATURE_SSSE3 : 0;
+        features |= (regs[2] & (1 << 19)) ? CPU_FEATURE_SSE41 : 0;
+
+        /* AVX2 also needs the OS to save the upper halves of the ymm registers */
+        if (max_leaf >= 7 && (regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6) {
+            __cpuidex(regs, 7, 0);
+            features |= (regs[1] & (1 << 5)) ? CPU_FEATURE_AVX2 : 0;
+        }
+    }
+#endif
+    return features;
+}
+
+#endif /* STDCOMPAT_CPUFEATURES_H */
@@ -0,0 +1,61 @@
+/**
+ * @file
+ *
+ * @brief Interface for a system service providing random numbers to every thread.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+
+#include "igzsystemservice.h"
+
+static constexpr uint32_t GZIID_cIGZRandomService = 0x8A3E15C2;
+
+class cIGZRandomService : public cIGZSystemService
+{
+public:
+    /**
+     * @brief Sets the seed every thread's generator is derived from, threads pick up the new seed on their next draw.
+     * @param seed Value to use to seed the generators, UINT32_MAX picks a seed from the current time.
+     */
+    virtual void SetMasterSeed(uint32_t seed) = 0;
+    /**
+     * @return The seed every thread's generator is currently derived from.
+     */
+    virtual uint32_t GetMasterSeed() const = 0;
+    /**
+     * @brief Generates a random 32bit unsigned integer from the calling thread's generator.
+     * @return Random value.
+     */
+    virtual uint32_t RandomUint32Uniform() = 0;
+    /**
+     * @brief Generates a random 32bit unsigned integer from the calling thread's generator.
+     * @param scale Value returned should be no larger than this.
+     * @return Random value.
+     */
+    virtual uint32_t RandomUint32Uniform(uint32_t scale) = 0;
+    /**
+     * @brief Generates a random 32bit unsigned integer within a range from the calling thread's generator.
+     * @param min Value returned should be no smaller than this.
+     * @param max Value returned should be no larger than this.
+     * @return Random value.
+     */
+    virtual int32_t RandomSint32RangeUniform(int32_t min, int32_t max) = 0;
+    /**
+     * @brief Generates a random 64bit floating point value from the calling thread's generator.
+     * @return Random value.
+     */
+    virtual double RandomDoubleUniform() = 0;
+    /**
+     * @brief Generates a random 64bit floating point value from the calling thread's generator.
+     * @param min Value returned should be no smaller than this.
+     * @param max Value returned should be no larger than this.
+     * @return Random value.
+     */
+    virtual double RandomDoubleRangeUniform(double min, double max) = 0;
+};
@@ -0,0 +1,50 @@
+/**
+ * @file
+ *
+ * @brief An interface for reader writer lock objects.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+#include <stdint.h>
+
+class cIGZReadWriteLock
+{
+public:
+    /**
+     * @brief Releases the object.
+     * @return Always 0.
+     */
+    virtual int32_t Release() = 0;
+    /**
+     * @brief Acquire shared access, will block while a writer holds or is waiting for the lock.
+     */
+    virtual void LockRead() = 0;
+    /**
+     * @brief Acquire shared access, will not block.
+     * @return If shared access was acquired.
+     */
+    virtual bool TryLockRead() = 0;
+    /**
+     * @brief Release shared access.
+     */
+    virtual void UnlockRead() = 0;
+    /**
+     * @brief Acquire exclusive access, will block.
+     */
+    virtual void LockWrite() = 0;
+    /**
+     * @brief Acquire exclusive access, will not block.
+     * @return If exclusive access was acquired.
+     */
+    virtual bool TryLockWrite() = 0;
+    /**
+     * @brief Release exclusive access.
+     */
+    virtual void UnlockWrite() = 0;
+};
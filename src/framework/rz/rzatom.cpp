@@ -0,0 +1,286 @@
+/**
+ * @file
+ *
+ * @brief Interned strings identified by a 32bit atom.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzatom.h"
+#include "rzcasefold.h"
+#include "rzcriticalsection.h"
+#include "rzfastalloc.h"
+#include "rzhash.h"
+#include "rzscopedarena.h"
+#include <cstring>
+
+namespace
+{
+// Entries live in pages that never move so they can be read without taking the lock.
+const uint32_t kPageBits = 12;
+const uint32_t kPageSize = 1 << kPageBits;
+const uint32_t kMaxPages = 4096;
+const uint32_t kInitialSlots = 1024;
+
+struct AtomEntry
+{
+    const char *mpString;
+    uint32_t mnLength;
+    uint32_t mnHash;
+    uint32_t mnFolded;
+};
+
+inline uint32_t HashString(const char *pszString, uint32_t dwLength)
+{
+    return RZHash32(pszString, dwLength);
+}
+
+class cRZAtomTable
+{
+public:
+    cRZAtomTable() : mpSlots(nullptr), mnSlotCount(0), mnCount(0)
+    {
+        std::memset(mpPages, 0, sizeof(mpPages));
+
+        // Atom 0 is the empty string and is never placed in the hash table.
+        static const char empty[] = "";
+        AddEntry(empty, 0, HashString(empty, 0), 0);
+
+        // Atoms that failed to intern read as the empty string but keep an id that never compares equal to it.
+        mInvalid.mpString = empty;
+        mInvalid.mnLength = 0;
+        mInvalid.mnHash = HashString(empty, 0);
+        mInvalid.mnFolded = cRZAtom::kInvalidID;
+    }
+
+    // Returns cRZAtom::kInvalidID if memory ran out while adding the string.
+    uint32_t Intern(const char *pszString, uint32_t dwLength, bool bAdd)
+    {
+        if (dwLength == 0) {
+            return 0;
+        }
+
+        uint32_t hash = HashString(pszString, dwLength);
+        cRZLock lock(mLock);
+        uint32_t id = Lookup(pszString, dwLength, hash);
+
+        if (id != 0 || !bAdd) {
+            return id;
+        }
+
+        // Intern the folded form first, the buffer is handed back to the arena if it was already known.
+        uint32_t folded = 0;
+        bool has_upper = false;
+
+        for (uint32_t i = 0; i < dwLength && !has_upper; ++i) {
+            has_upper = RZFoldCase((unsigned char)pszString[i]) != (unsigned char)pszString[i];
+        }
+
+        if (has_upper) {
+            char *lower = static_cast<char *>(mStrings.Allocate(dwLength + 1, 1));
+
+            if (lower == nullptr) {
+                return cRZAtom::kInvalidID;
+            }
+
+            for (uint32_t i = 0; i < dwLength; ++i) {
+                lower[i] = char(RZFoldCase((unsigned char)pszString[i]));
+            }
+
+            lower[dwLength] = '\0';
+            uint32_t lower_hash = HashString(lower, dwLength);
+            folded = Lookup(lower, dwLength, lower_hash);
+
+            if (folded != 0) {
+                mStrings.Free(lower, dwLength + 1);
+            } else {
+                folded = AddEntry(lower, dwLength, lower_hash, mnCount);
+
+                if (folded == cRZAtom::kInvalidID) {
+                    mStrings.Free(lower, dwLength + 1);
+                    return cRZAtom::kInvalidID;
+                }
+            }
+        }
+
+        char *copy = static_cast<char *>(mStrings.Allocate(dwLength + 1, 1));
+
+        if (copy == nullptr) {
+            return cRZAtom::kInvalidID;
+        }
+
+        std::memcpy(copy, pszString, dwLength);
+        copy[dwLength] = '\0';
+        id = AddEntry(copy, dwLength, hash, has_upper ? folded : mnCount);
+
+        if (id == cRZAtom::kInvalidID) {
+            mStrings.Free(copy, dwLength + 1);
+        }
+
+        return id;
+    }
+
+    const AtomEntry &Entry(uint32_t id) const
+    {
+        return id != cRZAtom::kInvalidID ? mpPages[id >> kPageBits][id & (kPageSize - 1)] : mInvalid;
+    }
+
+private:
+    uint32_t Lookup(const char *pszString, uint32_t dwLength, uint32_t hash) const
+    {
+        if (mpSlots == nullptr) {
+            return 0;
+        }
+
+        uint32_t mask = mnSlotCount - 1;
+
+        for (uint32_t slot = hash & mask; mpSlots[slot] != 0; slot = (slot + 1) & mask) {
+            const AtomEntry &entry = PageEntry(mpSlots[slot]);
+
+            if (entry.mnHash == hash && entry.mnLength == dwLength
+                && std::memcmp(entry.mpString, pszString, dwLength) == 0) {
+                return mpSlots[slot];
+            }
+        }
+
+        return 0;
+    }
+
+    const AtomEntry &PageEntry(uint32_t id) const { return mpPages[id >> kPageBits][id & (kPageSize - 1)]; }
+
+    uint32_t AddEntry(const char *pszString, uint32_t dwLength, uint32_t hash, uint32_t folded)
+    {
+        uint32_t id = mnCount;
+        uint32_t page = id >> kPageBits;
+
+        if (page >= kMaxPages) {
+            return cRZAtom::kInvalidID;
+        }
+
+        if (mpPages[page] == nullptr) {
+            mpPages[page] = static_cast<AtomEntry *>(RZFastAlloc(sizeof(AtomEntry) * kPageSize));
+
+            if (mpPages[page] == nullptr) {
+                return cRZAtom::kInvalidID;
+            }
+        }
+
+        // Growing before the entry is counted means a failed grow leaves the table as it was.
+        if (id != 0 && (id + 2) * 4 > mnSlotCount * 3 && !Grow()) {
+            return cRZAtom::kInvalidID;
+        }
+
+        AtomEntry &entry = mpPages[page][id & (kPageSize - 1)];
+        entry.mpString = pszString;
+        entry.mnLength = dwLength;
+        entry.mnHash = hash;
+        entry.mnFolded = folded;
+        ++mnCount;
+
+        if (id != 0) {
+            Insert(id, hash);
+        }
+
+        return id;
+    }
+
+    void Insert(uint32_t id, uint32_t hash)
+    {
+        uint32_t mask = mnSlotCount - 1;
+        uint32_t slot = hash & mask;
+
+        while (mpSlots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+
+        mpSlots[slot] = id;
+    }
+
+    bool Grow()
+    {
+        uint32_t slot_count = mnSlotCount == 0 ? kInitialSlots : mnSlotCount * 2;
+        uint32_t *slots = static_cast<uint32_t *>(RZFastAlloc(sizeof(uint32_t) * slot_count));
+
+        if (slots == nullptr) {
+            return false;
+        }
+
+        uint32_t *old_slots = mpSlots;
+        uint32_t old_count = mnSlotCount;
+
+        std::memset(slots, 0, sizeof(uint32_t) * slot_count);
+        mpSlots = slots;
+        mnSlotCount = slot_count;
+
+        for (uint32_t i = 0; i < old_count; ++i) {
+            if (old_slots[i] != 0) {
+                Insert(old_slots[i], PageEntry(old_slots[i]).mnHash);
+            }
+        }
+
+        RZFastFreeSized(old_slots, sizeof(uint32_t) * old_count);
+
+        return true;
+    }
+
+private:
+    cRZCriticalSection mLock;
+    cRZScopedArena mStrings;
+    AtomEntry *mpPages[kMaxPages];
+    uint32_t *mpSlots;
+    uint32_t mnSlotCount;
+    uint32_t mnCount;
+    AtomEntry mInvalid;
+};
+
+// Deliberately never destroyed, atoms may still be used by other static destructors.
+cRZAtomTable &AtomTable()
+{
+    static cRZAtomTable *table = new cRZAtomTable;
+    return *table;
+}
+} // namespace
+
+cRZAtom::cRZAtom(const char *pszString) :
+    mnID(pszString != nullptr ? AtomTable().Intern(pszString, uint32_t(std::strlen(pszString)), true) : 0)
+{
+}
+
+cRZAtom::cRZAtom(const char *pszString, uint32_t dwLength) : mnID(AtomTable().Intern(pszString, dwLength, true)) {}
+
+cRZAtom::cRZAtom(const cIGZString &szString) : mnID(AtomTable().Intern(szString.Data(), szString.Strlen(), true)) {}
+
+cRZAtom cRZAtom::Find(const char *pszString, uint32_t dwLength)
+{
+    cRZAtom atom;
+    atom.mnID = AtomTable().Intern(pszString, dwLength, false);
+
+    return atom;
+}
+
+const char *cRZAtom::ToChar() const
+{
+    return AtomTable().Entry(mnID).mpString;
+}
+
+uint32_t cRZAtom::Strlen() const
+{
+    return AtomTable().Entry(mnID).mnLength;
+}
+
+uint32_t cRZAtom::Hash() const
+{
+    return AtomTable().Entry(mnID).mnHash;
+}
+
+cRZAtom cRZAtom::Folded() const
+{
+    cRZAtom atom;
+    atom.mnID = AtomTable().Entry(mnID).mnFolded;
+
+    return atom;
+}
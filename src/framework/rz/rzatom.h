@@ -0,0 +1,74 @@
+/**
+ * @file
+ *
+ * @brief Interned strings identified by a 32bit atom.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+#include "igzstring.h"
+#include <stdint.h>
+
+/**
+ * @brief Handle to a string held in the global atom table
+ *
+ * Each distinct string is stored once for the lifetime of the program, so atoms compare and hash by their id alone.
+ * Every atom also knows the atom of its lower case form for case insensitive comparisons. The empty string is atom 0,
+ * which is also what a default constructed atom holds.
+ */
+class cRZAtom
+{
+public:
+    enum : uint32_t
+    {
+        kInvalidID = UINT32_MAX, // Held by atoms whose string could not be interned because memory ran out.
+    };
+
+    cRZAtom() : mnID(0) {}
+    explicit cRZAtom(const char *pszString);
+    cRZAtom(const char *pszString, uint32_t dwLength);
+    explicit cRZAtom(const cIGZString &szString);
+
+    /**
+     * @brief Looks up the atom for a string without adding it to the table.
+     * @return The atom or the empty atom if the string has never been interned.
+     */
+    static cRZAtom Find(const char *pszString, uint32_t dwLength);
+
+    uint32_t ID() const { return mnID; }
+    bool IsEmpty() const { return mnID == 0; }
+    /**
+     * @brief Checks the string was interned, an atom that failed reads as an empty string but isn't equal to one.
+     */
+    bool IsValid() const { return mnID != kInvalidID; }
+
+    /**
+     * @brief Gets the interned string, which stays valid for the lifetime of the program.
+     */
+    const char *ToChar() const;
+    uint32_t Strlen() const;
+    /**
+     * @brief Gets the hash of the string that was calculated when it was interned.
+     */
+    uint32_t Hash() const;
+    /**
+     * @brief Gets the atom of the string with ASCII letters folded to lower case.
+     */
+    cRZAtom Folded() const;
+
+    bool IsEqual(cRZAtom other, bool bCaseSensitive) const
+    {
+        return bCaseSensitive ? mnID == other.mnID : Folded().mnID == other.Folded().mnID;
+    }
+
+    bool operator==(cRZAtom other) const { return mnID == other.mnID; }
+    bool operator!=(cRZAtom other) const { return mnID != other.mnID; }
+
+private:
+    uint32_t mnID;
+};
@@ -0,0 +1,242 @@
+/**
+ * @file
+ *
+ * @brief Case insensitive string comparison and searching that never allocates.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzcasefold.h"
+
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define HAVE_SSE2_FOLD 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+const size_t kNotFound = size_t(-1);
+
+// Needles at least this long over haystacks with room for a few skips are searched with Boyer-Moore-Horspool.
+const size_t kHorspoolNeedleLen = 4;
+const size_t kHorspoolSlack = 32;
+
+#ifdef HAVE_SSE2_FOLD
+inline __m128i FoldCase16(__m128i v)
+{
+    // Bytes of 0x80 and up are negative as signed chars so they never land in the A-Z range.
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), v));
+    return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+inline int CountTrailingZeros(unsigned mask)
+{
+#if defined __GNUC__ || defined __clang__
+    return __builtin_ctz(mask);
+#else
+    int count = 0;
+
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        ++count;
+    }
+
+    return count;
+#endif
+}
+#endif
+
+// Returns the offset of the first pair of characters that differ after folding, or nLen if there is none.
+size_t FoldMismatch(const unsigned char *pLeft, const unsigned char *pRight, size_t nLen)
+{
+    size_t i = 0;
+#ifdef HAVE_SSE2_FOLD
+    for (; i + 16 <= nLen; i += 16) {
+        __m128i left = FoldCase16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pLeft + i)));
+        __m128i right = FoldCase16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pRight + i)));
+        unsigned mask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(left, right))) ^ 0xFFFF;
+
+        if (mask != 0) {
+            return i + CountTrailingZeros(mask);
+        }
+    }
+#endif
+    for (; i < nLen; ++i) {
+        if (RZFoldCase(pLeft[i]) != RZFoldCase(pRight[i])) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+inline bool FoldEqual(const unsigned char *pLeft, const unsigned char *pRight, size_t nLen)
+{
+    return FoldMismatch(pLeft, pRight, nLen) == nLen;
+}
+
+size_t HorspoolFind(const unsigned char *pHay, size_t nHayLen, const unsigned char *pNeedle, size_t nNeedleLen, size_t nPos)
+{
+    size_t skip[256];
+    size_t last = nNeedleLen - 1;
+
+    for (size_t i = 0; i < 256; ++i) {
+        skip[i] = nNeedleLen;
+    }
+
+    // Both cases of a letter share a skip so the haystack can be indexed without folding it first.
+    for (size_t i = 0; i < last; ++i) {
+        unsigned char c = RZFoldCase(pNeedle[i]);
+        skip[c] = last - i;
+
+        if (c >= 'a' && c <= 'z') {
+            skip[c & ~0x20] = last - i;
+        }
+    }
+
+    unsigned char tail = RZFoldCase(pNeedle[last]);
+
+    for (size_t pos = nPos; pos + nNeedleLen <= nHayLen; pos += skip[pHay[pos + last]]) {
+        if (RZFoldCase(pHay[pos + last]) == tail && FoldEqual(pHay + pos, pNeedle, last)) {
+            return pos;
+        }
+    }
+
+    return kNotFound;
+}
+
+size_t LinearFind(const unsigned char *pHay, size_t nHayLen, const unsigned char *pNeedle, size_t nNeedleLen, size_t nPos)
+{
+    unsigned char first = RZFoldCase(pNeedle[0]);
+    size_t end = nHayLen - nNeedleLen + 1;
+    size_t pos = nPos;
+#ifdef HAVE_SSE2_FOLD
+    // Compare against the folded first character 16 candidates at a time and only verify the hits.
+    __m128i target = _mm_set1_epi8(char(first));
+
+    for (; pos + 16 <= end; pos += 16) {
+        __m128i block = FoldCase16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pHay + pos)));
+        unsigned mask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block, target)));
+
+        while (mask != 0) {
+            size_t hit = pos + CountTrailingZeros(mask);
+
+            if (FoldEqual(pHay + hit + 1, pNeedle + 1, nNeedleLen - 1)) {
+                return hit;
+            }
+
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; pos < end; ++pos) {
+        if (RZFoldCase(pHay[pos]) == first && FoldEqual(pHay + pos + 1, pNeedle + 1, nNeedleLen - 1)) {
+            return pos;
+        }
+    }
+
+    return kNotFound;
+}
+
+// Mirror of HorspoolFind that slides the window leftwards, skipping on the character under its first position.
+size_t HorspoolRFind(const unsigned char *pHay, const unsigned char *pNeedle, size_t nNeedleLen, size_t nStart)
+{
+    size_t skip[256];
+
+    for (size_t i = 0; i < 256; ++i) {
+        skip[i] = nNeedleLen;
+    }
+
+    for (size_t i = nNeedleLen - 1; i > 0; --i) {
+        unsigned char c = RZFoldCase(pNeedle[i]);
+        skip[c] = i;
+
+        if (c >= 'a' && c <= 'z') {
+            skip[c & ~0x20] = i;
+        }
+    }
+
+    unsigned char head = RZFoldCase(pNeedle[0]);
+
+    for (size_t pos = nStart;;) {
+        if (RZFoldCase(pHay[pos]) == head && FoldEqual(pHay + pos + 1, pNeedle + 1, nNeedleLen - 1)) {
+            return pos;
+        }
+
+        size_t step = skip[pHay[pos]];
+
+        if (step > pos) {
+            return kNotFound;
+        }
+
+        pos -= step;
+    }
+}
+} // namespace
+
+int32_t RZCaseCompare(const char *pszLeft, size_t nLeftLen, const char *pszRight, size_t nRightLen)
+{
+    const unsigned char *left = reinterpret_cast<const unsigned char *>(pszLeft);
+    const unsigned char *right = reinterpret_cast<const unsigned char *>(pszRight);
+    size_t len = nLeftLen < nRightLen ? nLeftLen : nRightLen;
+    size_t mismatch = FoldMismatch(left, right, len);
+
+    if (mismatch != len) {
+        return int32_t(RZFoldCase(left[mismatch])) - int32_t(RZFoldCase(right[mismatch]));
+    }
+
+    return int32_t(nLeftLen - nRightLen);
+}
+
+bool RZCaseEqual(const char *pszLeft, size_t nLeftLen, const char *pszRight, size_t nRightLen)
+{
+    return nLeftLen == nRightLen
+        && FoldEqual(
+            reinterpret_cast<const unsigned char *>(pszLeft), reinterpret_cast<const unsigned char *>(pszRight), nLeftLen);
+}
+
+size_t RZCaseFind(const char *pszHaystack, size_t nHaystackLen, const char *pszNeedle, size_t nNeedleLen, size_t nPos)
+{
+    if (nPos > nHaystackLen || nNeedleLen > nHaystackLen - nPos) {
+        return kNotFound;
+    }
+
+    if (nNeedleLen == 0) {
+        return nPos;
+    }
+
+    const unsigned char *hay = reinterpret_cast<const unsigned char *>(pszHaystack);
+    const unsigned char *needle = reinterpret_cast<const unsigned char *>(pszNeedle);
+
+    if (nNeedleLen >= kHorspoolNeedleLen && nHaystackLen - nPos - nNeedleLen >= kHorspoolSlack) {
+        return HorspoolFind(hay, nHaystackLen, needle, nNeedleLen, nPos);
+    }
+
+    return LinearFind(hay, nHaystackLen, needle, nNeedleLen, nPos);
+}
+
+size_t RZCaseRFind(const char *pszHaystack, size_t nHaystackLen, const char *pszNeedle, size_t nNeedleLen, size_t nPos)
+{
+    if (nNeedleLen > nHaystackLen) {
+        return kNotFound;
+    }
+
+    size_t start = nHaystackLen - nNeedleLen;
+
+    if (nPos < start) {
+        start = nPos;
+    }
+
+    if (nNeedleLen == 0) {
+        return start;
+    }
+
+    return HorspoolRFind(reinterpret_cast<const unsigned char *>(pszHaystack),
+        reinterpret_cast<const unsigned char *>(pszNeedle),
+        nNeedleLen,
+        start);
+}
@@ -0,0 +1,41 @@
+/**
+ * @file
+ *
+ * @brief Case insensitive string comparison and searching that never allocates.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Only ASCII letters are folded, matching strncasecmp in the C locale.
+inline unsigned char RZFoldCase(unsigned char c)
+{
+    return unsigned(c - 'A') < 26u ? c | 0x20 : c;
+}
+
+/**
+ * @brief Compares two strings ignoring ASCII case.
+ * @return Difference of the first pair of folded characters that differ, otherwise the difference in length.
+ */
+int32_t RZCaseCompare(const char *pszLeft, size_t nLeftLen, const char *pszRight, size_t nRightLen);
+/**
+ * @brief Tests two strings for equality ignoring ASCII case.
+ */
+bool RZCaseEqual(const char *pszLeft, size_t nLeftLen, const char *pszRight, size_t nRightLen);
+/**
+ * @brief Finds the first occurrence of a needle ignoring ASCII case, with the same semantics as std::string::find.
+ * @return Position of the match or size_t(-1) if there isn't one.
+ */
+size_t RZCaseFind(const char *pszHaystack, size_t nHaystackLen, const char *pszNeedle, size_t nNeedleLen, size_t nPos);
+/**
+ * @brief Finds the last occurrence of a needle ignoring ASCII case, with the same semantics as std::string::rfind.
+ * @return Position of the match or size_t(-1) if there isn't one.
+ */
+size_t RZCaseRFind(const char *pszHaystack, size_t nHaystackLen, const char *pszNeedle, size_t nNeedleLen, size_t nPos);
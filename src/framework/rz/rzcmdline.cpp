@@ -65,17 +65,19 @@ bool cRZCmdLine::QueryInterface(uint32_t iid, void **obj)
 
 uint32_t cRZCmdLine::AddRef()
 {
-    return ++mnRefCount;
+    return mnRefCount.AddRef();
 }
 
 uint32_t cRZCmdLine::Release()
 {
-    if (mnRefCount <= 1) {
+    uint32_t count = mnRefCount.ReleaseSigned();
+
+    if (count == 0) {
         delete this;
         return 0;
     }
 
-    return --mnRefCount;
+    return count;
 }
 
 int32_t cRZCmdLine::ArgC() const
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "igzcmdline.h"
+#include "rzrefcount.h"
 #include "rzstring.h"
 #include <vector>
 
@@ -135,7 +136,7 @@ private:
     void ConvertStringArrayToString(const std::vector<cRZString> &array, cRZString &string);
 
 private:
-    int32_t mnRefCount;
+    cRZRefCountMT mnRefCount;
     std::vector<cRZString> mArguments;
     cRZString mzCmdLineText;
     cRZString mzDefaultArgument;
@@ -12,6 +12,7 @@
  */
 #include "rzcomdlldirector.h"
 #include "igzcom.h"
+#include "rzfastalloc.h"
 
 cIGZCOM *GZCOM()
 {
@@ -59,7 +60,7 @@ bool cRZCOMDllDirector::QueryInterface(uint32_t riid, void **ppvObj)
 
 uint32_t cRZCOMDllDirector::AddRef()
 {
-    return ++mnRefCount;
+    return mnRefCount.AddRef();
 }
 
 uint32_t cRZCOMDllDirector::Release()
@@ -143,7 +144,7 @@ bool cRZCOMDllDirector::GetClassObject(uint32_t rclsid, uint32_t riid, void **pp
 
 bool cRZCOMDllDirector::CanUnloadNow()
 {
-    if (mnRefCount == 0) {
+    if (mnRefCount.Count() == 0) {
         for (ChildDirectorArray::iterator it(mChildDirectorArray.begin()); it != mChildDirectorArray.end(); ++it) {
             cRZCOMDllDirector *const pCOMDirectorTemp = *it;
             if (!pCOMDirectorTemp->CanUnloadNow()) {
@@ -157,16 +158,12 @@ bool cRZCOMDllDirector::CanUnloadNow()
 
 uint32_t cRZCOMDllDirector::RefCount()
 {
-    return mnRefCount;
+    return mnRefCount.Count();
 }
 
 uint32_t cRZCOMDllDirector::RemoveRef()
 {
-    if (mnRefCount > 0) {
-        --mnRefCount;
-    }
-
-    return mnRefCount;
+    return mnRefCount.RemoveRef();
 }
 
 cIGZFrameWork *cRZCOMDllDirector::FrameWork()
@@ -187,7 +184,14 @@ bool cRZCOMDllDirector::GetLibraryPath(cIGZString &sLibraryPath)
 
 uint32_t cRZCOMDllDirector::GetHeapAllocatedSize()
 {
-    return 0;
+    // Each plugin links its own copy of the allocator so this only covers allocations made by this library.
+    RZFastAllocStats stats;
+
+    if (!RZFastAllocGetStats(stats) || stats.mnBytesInUse <= 0) {
+        return 0;
+    }
+
+    return stats.mnBytesInUse > int64_t(UINT32_MAX) ? UINT32_MAX : uint32_t(stats.mnBytesInUse);
 }
 
 bool cRZCOMDllDirector::PreFrameWorkInit()
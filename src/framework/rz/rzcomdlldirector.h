@@ -14,6 +14,7 @@
 #include "igzcomdirector.h"
 #include "igzframeworkhooks.h"
 #include "rzfastalloc.h"
+#include "rzrefcount.h"
 #include "rzstring.h"
 
 #ifdef MATCH_ABI // STLPort is needed to match at ABI level and uses none standard hash_map.
@@ -96,7 +97,7 @@ protected:
         ClassObjectMap;
 #endif
 
-    uint32_t mnRefCount;
+    cRZRefCountMT mnRefCount;
     uint32_t mDirectorID;
     cRZString msLibraryPath;
     cIGZCOM *mpCOM;
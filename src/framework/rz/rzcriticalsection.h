@@ -14,6 +14,14 @@
 #include "igzcriticalsection.h"
 #include <new>
 
+#ifndef _WIN32
+#include <atomic>
+#endif
+
+#ifdef RZ_LOCK_PROFILING
+struct RZLockProfile;
+#endif
+
 /**
  * @brief Scoped lock for cIGZCriticalSection objects.
  */
@@ -29,7 +37,9 @@ private:
 
 class cRZCriticalSection : public cIGZCriticalSection
 {
+#ifdef _WIN32
     struct CritSecImpl;
+#endif
 
 public:
     cRZCriticalSection();
@@ -66,11 +76,37 @@ public:
      */
     virtual int32_t IsLocked() override;
 
+    /**
+     * @return Number of times a thread had to wait because another thread held the critical section.
+     */
+    uint32_t GetContentionCount() const;
+    /**
+     * @brief Names the critical section so its statistics are reported separately when built with LOCK_PROFILING.
+     * @param pszName Name with static lifetime, critical sections sharing a name are reported together.
+     */
+#ifdef RZ_LOCK_PROFILING
+    void SetName(const char *pszName);
+#else
+    void SetName(const char *) {}
+#endif
+
     /**
      * Used to hook the constructor when injecting as a dll.
      */
     cRZCriticalSection *Hookable_Ctor() { return new (this) cRZCriticalSection(); }
 
 private:
+#ifdef _WIN32
     CritSecImpl *mCriticalSection;
+#else
+    // Lock word is 0 when unlocked, 1 when locked and 2 when locked with threads possibly waiting on it.
+    std::atomic<uint32_t> mnState;
+    std::atomic<int32_t> mnLockCount;
+    std::atomic<uintptr_t> mnOwner;
+    std::atomic<uint32_t> mnContentionCount;
+#ifdef RZ_LOCK_PROFILING
+    RZLockProfile *mpProfile;
+    uint64_t mnHoldStart;
+#endif
+#endif
 };
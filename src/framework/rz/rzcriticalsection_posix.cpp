@@ -11,38 +11,64 @@
  *            LICENSE
  */
 #include "rzcriticalsection.h"
-#include <cstdlib>
-#include <cstring>
-#include <pthread.h>
+#include "rzfutex.h"
+#include "rzlockprofiler.h"
 
-struct cRZCriticalSection::CritSecImpl
+namespace
 {
-    pthread_mutex_t mutex;
-    int32_t lock_count;
+// Most critical sections are held for a handful of instructions so a short spin usually beats sleeping.
+const int kSpinCount = 128;
+
+enum
+{
+    kUnlocked = 0,
+    kLocked = 1,
+    kLockedWaiters = 2,
 };
 
-cRZCriticalSection::cRZCriticalSection() : mCriticalSection(nullptr)
+// The address of a thread local is a cheap identity that is unique among running threads.
+inline uintptr_t ThreadTag()
+{
+    static thread_local char tag;
+    return reinterpret_cast<uintptr_t>(&tag);
+}
+
+void LockContended(std::atomic<uint32_t> &state, std::atomic<uint32_t> &contention)
 {
-    CritSecImpl *cs = (CritSecImpl *)std::malloc(sizeof(CritSecImpl));
+    contention.fetch_add(1, std::memory_order_relaxed);
 
-    cs->lock_count = 0;
-    std::memset(&cs->mutex, 0, sizeof(cs->mutex));
-    mCriticalSection = cs;
+    for (int i = 0; i < kSpinCount; ++i) {
+        RZCpuRelax();
+        uint32_t expected = kUnlocked;
 
-    pthread_mutexattr_t attr;
-    pthread_mutexattr_init(&attr);
-    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
-    pthread_mutex_init(&cs->mutex, &attr);
-    pthread_mutexattr_destroy(&attr);
+        if (state.load(std::memory_order_relaxed) == kUnlocked
+            && state.compare_exchange_weak(expected, kLocked, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    // Taking the lock in the waiters state is pessimistic but only costs a spurious wake on unlock.
+    while (state.exchange(kLockedWaiters, std::memory_order_acquire) != kUnlocked) {
+        RZFutexWait(state, kLockedWaiters);
+    }
 }
+} // namespace
 
-cRZCriticalSection::~cRZCriticalSection()
+cRZCriticalSection::cRZCriticalSection() :
+    mnState(kUnlocked),
+    mnLockCount(0),
+    mnOwner(0),
+    mnContentionCount(0)
+#ifdef RZ_LOCK_PROFILING
+    ,
+    mpProfile(nullptr),
+    mnHoldStart(0)
+#endif
 {
-    pthread_mutex_destroy(&mCriticalSection->mutex);
-    free(mCriticalSection);
-    mCriticalSection = nullptr;
 }
 
+cRZCriticalSection::~cRZCriticalSection() {}
+
 int32_t cRZCriticalSection::Release()
 {
     delete this;
@@ -51,18 +77,57 @@ int32_t cRZCriticalSection::Release()
 
 int32_t cRZCriticalSection::Lock()
 {
-    if (pthread_mutex_lock(&mCriticalSection->mutex) == 0) {
-        ++mCriticalSection->lock_count;
+    uintptr_t self = ThreadTag();
+
+    // Only this thread could have stored its own tag so a relaxed load is enough to detect recursion.
+    if (mnOwner.load(std::memory_order_relaxed) == self) {
+        int32_t count = mnLockCount.load(std::memory_order_relaxed) + 1;
+        mnLockCount.store(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    uint32_t expected = kUnlocked;
+
+    if (!mnState.compare_exchange_strong(expected, kLocked, std::memory_order_acquire, std::memory_order_relaxed)) {
+#ifdef RZ_LOCK_PROFILING
+        uint64_t wait_start = RZLockProfileNow();
+        LockContended(mnState, mnContentionCount);
+        RZLockProfileWaited(mpProfile, RZLockProfileNow() - wait_start);
+#else
+        LockContended(mnState, mnContentionCount);
+#endif
     }
 
-    return mCriticalSection->lock_count;
+    mnOwner.store(self, std::memory_order_relaxed);
+    mnLockCount.store(1, std::memory_order_relaxed);
+#ifdef RZ_LOCK_PROFILING
+    RZLockProfileAcquired(mpProfile);
+    mnHoldStart = RZLockProfileNow();
+#endif
+
+    return 1;
 }
 
 int32_t cRZCriticalSection::Unlock()
 {
-    --mCriticalSection->lock_count;
-    if (pthread_mutex_unlock(&mCriticalSection->mutex) == 0) {
-        return mCriticalSection->lock_count;
+    if (mnOwner.load(std::memory_order_relaxed) != ThreadTag()) {
+        return 0;
+    }
+
+    int32_t count = mnLockCount.load(std::memory_order_relaxed) - 1;
+    mnLockCount.store(count, std::memory_order_relaxed);
+
+    if (count != 0) {
+        return count;
+    }
+
+    mnOwner.store(0, std::memory_order_relaxed);
+#ifdef RZ_LOCK_PROFILING
+    RZLockProfileHeld(mpProfile, RZLockProfileNow() - mnHoldStart);
+#endif
+
+    if (mnState.exchange(kUnlocked, std::memory_order_release) == kLockedWaiters) {
+        RZFutexWake(mnState, 1);
     }
 
     return 0;
@@ -70,11 +135,28 @@ int32_t cRZCriticalSection::Unlock()
 
 int32_t cRZCriticalSection::TryLock()
 {
-    if (pthread_mutex_trylock(&mCriticalSection->mutex) == 0) {
-        ++mCriticalSection->lock_count;
+    uintptr_t self = ThreadTag();
+
+    if (mnOwner.load(std::memory_order_relaxed) == self) {
+        int32_t count = mnLockCount.load(std::memory_order_relaxed) + 1;
+        mnLockCount.store(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    uint32_t expected = kUnlocked;
+
+    if (!mnState.compare_exchange_strong(expected, kLocked, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return 0;
     }
 
-    return mCriticalSection->lock_count;
+    mnOwner.store(self, std::memory_order_relaxed);
+    mnLockCount.store(1, std::memory_order_relaxed);
+#ifdef RZ_LOCK_PROFILING
+    RZLockProfileAcquired(mpProfile);
+    mnHoldStart = RZLockProfileNow();
+#endif
+
+    return 1;
 }
 
 int32_t cRZCriticalSection::IsValid()
@@ -84,5 +166,17 @@ int32_t cRZCriticalSection::IsValid()
 
 int32_t cRZCriticalSection::IsLocked()
 {
-    return mCriticalSection->lock_count;
+    return mnLockCount.load(std::memory_order_relaxed);
+}
+
+uint32_t cRZCriticalSection::GetContentionCount() const
+{
+    return mnContentionCount.load(std::memory_order_relaxed);
+}
+
+#ifdef RZ_LOCK_PROFILING
+void cRZCriticalSection::SetName(const char *pszName)
+{
+    mpProfile = RZLockProfileFind(pszName);
 }
+#endif
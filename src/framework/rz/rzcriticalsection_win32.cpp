@@ -11,6 +11,8 @@
  *            LICENSE
  */
 #include "rzcriticalsection.h"
+#include "rzlockprofiler.h"
+#include "rzthreadsafe.h"
 #include <stdlib.h>
 #include <string.h>
 #include <windows.h>
@@ -19,6 +21,11 @@ struct cRZCriticalSection::CritSecImpl
 {
     CRITICAL_SECTION mutex;
     int32_t lock_count;
+    volatile uint32_t contention_count;
+#ifdef RZ_LOCK_PROFILING
+    RZLockProfile *profile;
+    uint64_t hold_start;
+#endif
 };
 
 cRZCriticalSection::cRZCriticalSection() : mCriticalSection(nullptr)
@@ -26,6 +33,11 @@ cRZCriticalSection::cRZCriticalSection() : mCriticalSection(nullptr)
     CritSecImpl *cs = (CritSecImpl *)malloc(sizeof(CritSecImpl));
 
     cs->lock_count = 0;
+    cs->contention_count = 0;
+#ifdef RZ_LOCK_PROFILING
+    cs->profile = nullptr;
+    cs->hold_start = 0;
+#endif
     memset(&cs->mutex, 0, sizeof(cs->mutex));
     mCriticalSection = cs;
     InitializeCriticalSection(&mCriticalSection->mutex);
@@ -46,14 +58,36 @@ int32_t cRZCriticalSection::Release()
 
 int32_t cRZCriticalSection::Lock()
 {
-    EnterCriticalSection(&mCriticalSection->mutex);
+    if (!TryEnterCriticalSection(&mCriticalSection->mutex)) {
+        RZThreadSafeAdd(mCriticalSection->contention_count, 1);
+#ifdef RZ_LOCK_PROFILING
+        uint64_t wait_start = RZLockProfileNow();
+        EnterCriticalSection(&mCriticalSection->mutex);
+        RZLockProfileWaited(mCriticalSection->profile, RZLockProfileNow() - wait_start);
+#else
+        EnterCriticalSection(&mCriticalSection->mutex);
+#endif
+    }
+
     ++mCriticalSection->lock_count;
+#ifdef RZ_LOCK_PROFILING
+    // Recursive entries are not new acquisitions and must not restart the hold timer.
+    if (mCriticalSection->lock_count == 1) {
+        RZLockProfileAcquired(mCriticalSection->profile);
+        mCriticalSection->hold_start = RZLockProfileNow();
+    }
+#endif
 
     return mCriticalSection->lock_count;
 }
 
 int32_t cRZCriticalSection::Unlock()
 {
+#ifdef RZ_LOCK_PROFILING
+    if (mCriticalSection->lock_count == 1) {
+        RZLockProfileHeld(mCriticalSection->profile, RZLockProfileNow() - mCriticalSection->hold_start);
+    }
+#endif
     --mCriticalSection->lock_count;
     LeaveCriticalSection(&mCriticalSection->mutex);
 
@@ -65,6 +99,12 @@ int32_t cRZCriticalSection::TryLock()
     bool locked = TryEnterCriticalSection(&mCriticalSection->mutex);
 
     if (locked) {
+#ifdef RZ_LOCK_PROFILING
+        if (mCriticalSection->lock_count == 0) {
+            RZLockProfileAcquired(mCriticalSection->profile);
+            mCriticalSection->hold_start = RZLockProfileNow();
+        }
+#endif
         ++mCriticalSection->lock_count;
         return mCriticalSection->lock_count;
     }
@@ -81,3 +121,15 @@ int32_t cRZCriticalSection::IsLocked()
 {
     return mCriticalSection->lock_count;
 }
+
+uint32_t cRZCriticalSection::GetContentionCount() const
+{
+    return mCriticalSection->contention_count;
+}
+
+#ifdef RZ_LOCK_PROFILING
+void cRZCriticalSection::SetName(const char *pszName)
+{
+    mCriticalSection->profile = RZLockProfileFind(pszName);
+}
+#endif
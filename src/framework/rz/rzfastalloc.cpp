@@ -12,7 +12,10 @@
  */
 #include "rzfastalloc.h"
 #include <cstdlib>
+#include <cstring>
 
+#ifdef DLL_BUILD
+// DLL builds replace the engine's own functions and the engine may hand these blocks to the CRT directly, so we keep to it.
 void *RZFastAlloc(size_t nCount)
 {
     return std::malloc(nCount);
@@ -23,7 +26,811 @@ void RZFastFree(void *pvMem)
     std::free(pvMem);
 }
 
+void RZFastFreeSized(void *pvMem, size_t nCount)
+{
+    std::free(pvMem);
+}
+
 void *RZFastRealloc(void *pvMem, size_t nCount)
 {
     return std::realloc(pvMem, nCount);
 }
+
+// The CRT heap is shared with the engine so there is nothing of our own to track.
+void RZFastAllocSetTracking(bool bEnable, uint32_t nSampleRate) {}
+
+bool RZFastAllocGetStats(RZFastAllocStats &stats)
+{
+    std::memset(&stats, 0, sizeof(stats));
+    return false;
+}
+
+uint32_t RZFastAllocEnumSamples(RZFastAllocSampleCallback pCallback, void *pContext)
+{
+    return 0;
+}
+#else
+#include <atomic>
+#include <thread>
+
+#ifdef _WIN32
+#include <malloc.h>
+#include <windows.h>
+#elif defined __APPLE__
+#include <execinfo.h>
+#include <malloc/malloc.h>
+#define HAVE_EXECINFO_H 1
+#else
+#include <malloc.h>
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define HAVE_EXECINFO_H 1
+#endif
+#endif
+
+namespace
+{
+// Small requests are rounded up to a multiple of the granularity and served from chunks that only hold one size class.
+constexpr size_t kGranularity = 16;
+constexpr size_t kMaxSmallSize = 256;
+constexpr size_t kClassCount = kMaxSmallSize / kGranularity;
+static_assert(kClassCount == kRZFastAllocSmallClasses, "Size classes don't match the statistics layout.");
+constexpr size_t kChunkShift = 16;
+constexpr size_t kChunkSize = size_t(1) << kChunkShift;
+
+// Blocks move between the thread caches and the shared lists in batches to keep lock traffic down.
+constexpr uint32_t kBatchCount = 64;
+constexpr uint32_t kCacheLimit = kBatchCount * 2;
+
+// The chunk map is a two level radix tree over the chunk number, so 48 bits of address space on 64bit platforms.
+constexpr unsigned kLeafBits = 16;
+constexpr size_t kLeafSize = size_t(1) << kLeafBits;
+constexpr unsigned kAddressBits = sizeof(void *) == 8 ? 48 : 32;
+constexpr size_t kRootSize = size_t(1) << (kAddressBits - kChunkShift - kLeafBits);
+
+struct FreeBlock
+{
+    FreeBlock *mpNext;
+};
+
+struct ChunkLeaf
+{
+    // Size class + 1 of each chunk, 0 for memory that didn't come from a chunk.
+    std::atomic<uint8_t> mClass[kLeafSize];
+};
+
+// Only ever used by the owning thread so needs no synchronisation.
+struct ClassCache
+{
+    FreeBlock *mpHead;
+    uint32_t mnCount;
+    char *mpBump;
+    char *mpBumpEnd;
+};
+
+struct ThreadCache
+{
+    ClassCache mClasses[kClassCount];
+};
+
+// Trivially destructible so it stays usable until the very end of the program, unlike std::mutex.
+class SpinLock
+{
+public:
+    void Lock()
+    {
+        while (mFlag.test_and_set(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    void Unlock() { mFlag.clear(std::memory_order_release); }
+
+private:
+    std::atomic_flag mFlag = ATOMIC_FLAG_INIT;
+};
+
+struct SharedClass
+{
+    SpinLock mLock;
+    FreeBlock *mpHead;
+    size_t mnCount;
+    char *mpBump;
+    char *mpBumpEnd;
+};
+
+enum ThreadCacheState : uint8_t
+{
+    CACHE_UNREGISTERED,
+    CACHE_LIVE,
+    CACHE_FINISHED,
+};
+
+std::atomic<ChunkLeaf *> gChunkMap[kRootSize];
+SpinLock gChunkMapLock;
+// Set once a small block has had to come from the system heap, from then on sized frees check the chunk map.
+std::atomic<bool> gSmallFallback;
+SharedClass gShared[kClassCount];
+
+thread_local ThreadCache tCache;
+thread_local ThreadCacheState tCacheState;
+
+inline size_t ClassSize(unsigned cls)
+{
+    return (cls + 1) * kGranularity;
+}
+
+inline unsigned SizeClass(size_t size)
+{
+    return size == 0 ? 0 : unsigned((size - 1) / kGranularity);
+}
+
+// Returns the size class of the chunk holding the block or -1 if it came from the system heap.
+inline int ChunkClass(const void *pMem)
+{
+    uintptr_t chunk = uintptr_t(pMem) >> kChunkShift;
+    uintptr_t root = chunk >> kLeafBits;
+
+    if (root >= kRootSize) {
+        return -1;
+    }
+
+    ChunkLeaf *leaf = gChunkMap[root].load(std::memory_order_acquire);
+
+    if (leaf == nullptr) {
+        return -1;
+    }
+
+    return int(leaf->mClass[chunk & (kLeafSize - 1)].load(std::memory_order_relaxed)) - 1;
+}
+
+inline size_t SystemBlockSize(void *pMem)
+{
+#ifdef _WIN32
+    return _msize(pMem);
+#elif defined __APPLE__
+    return malloc_size(pMem);
+#else
+    return malloc_usable_size(pMem);
+#endif
+}
+
+void FreeChunk(void *pChunk)
+{
+#ifdef _WIN32
+    _aligned_free(pChunk);
+#else
+    std::free(pChunk);
+#endif
+}
+
+// Returns nullptr if no chunk could be allocated or the chunk lies outside the address range the chunk map covers.
+char *AllocChunk(unsigned cls)
+{
+    void *chunk = nullptr;
+#ifdef _WIN32
+    chunk = _aligned_malloc(kChunkSize, kChunkSize);
+#else
+    if (posix_memalign(&chunk, kChunkSize, kChunkSize) != 0) {
+        chunk = nullptr;
+    }
+#endif
+
+    if (chunk == nullptr) {
+        return nullptr;
+    }
+
+    uintptr_t number = uintptr_t(chunk) >> kChunkShift;
+    uintptr_t root = number >> kLeafBits;
+
+    // Chunks are never released so leaves are only ever added.
+    if (root >= kRootSize) {
+        FreeChunk(chunk);
+        return nullptr;
+    }
+
+    gChunkMapLock.Lock();
+    ChunkLeaf *leaf = gChunkMap[root].load(std::memory_order_relaxed);
+
+    if (leaf == nullptr) {
+        leaf = static_cast<ChunkLeaf *>(std::calloc(1, sizeof(ChunkLeaf)));
+
+        if (leaf != nullptr) {
+            gChunkMap[root].store(leaf, std::memory_order_release);
+        }
+    }
+
+    gChunkMapLock.Unlock();
+
+    if (leaf == nullptr) {
+        FreeChunk(chunk);
+        return nullptr;
+    }
+
+    leaf->mClass[number & (kLeafSize - 1)].store(uint8_t(cls + 1), std::memory_order_release);
+
+    return static_cast<char *>(chunk);
+}
+
+// Links up to nMax blocks from the shared list and returns the head, nCount receives how many were taken.
+FreeBlock *TakeShared(unsigned cls, uint32_t nMax, uint32_t &nCount)
+{
+    SharedClass &shared = gShared[cls];
+    FreeBlock *head;
+
+    shared.mLock.Lock();
+    head = shared.mpHead;
+    FreeBlock *tail = head;
+    nCount = 0;
+
+    if (head != nullptr) {
+        nCount = 1;
+
+        while (nCount < nMax && tail->mpNext != nullptr) {
+            tail = tail->mpNext;
+            ++nCount;
+        }
+
+        shared.mpHead = tail->mpNext;
+        shared.mnCount -= nCount;
+        tail->mpNext = nullptr;
+    }
+
+    shared.mLock.Unlock();
+
+    return head;
+}
+
+// Small blocks that can't be pooled come from the system heap, which the chunk map tells apart when they are freed.
+void *FallbackAlloc(unsigned cls)
+{
+    gSmallFallback.store(true, std::memory_order_relaxed);
+    return std::malloc(ClassSize(cls));
+}
+
+void GiveShared(unsigned cls, FreeBlock *pHead, FreeBlock *pTail, uint32_t nCount)
+{
+    SharedClass &shared = gShared[cls];
+
+    shared.mLock.Lock();
+    pTail->mpNext = shared.mpHead;
+    shared.mpHead = pHead;
+    shared.mnCount += nCount;
+    shared.mLock.Unlock();
+}
+
+// Used once a thread's cache has been torn down, for example by destructors running at thread or program exit.
+void *SharedAlloc(unsigned cls)
+{
+    SharedClass &shared = gShared[cls];
+    void *block = nullptr;
+
+    shared.mLock.Lock();
+
+    if (shared.mpHead != nullptr) {
+        block = shared.mpHead;
+        shared.mpHead = shared.mpHead->mpNext;
+        --shared.mnCount;
+    } else {
+        if (shared.mpBump == shared.mpBumpEnd) {
+            shared.mpBump = AllocChunk(cls);
+            shared.mpBumpEnd = shared.mpBump != nullptr ? shared.mpBump + kChunkSize : nullptr;
+        }
+
+        if (shared.mpBump != nullptr) {
+            block = shared.mpBump;
+            shared.mpBump += ClassSize(cls);
+
+            if (size_t(shared.mpBumpEnd - shared.mpBump) < ClassSize(cls)) {
+                shared.mpBump = shared.mpBumpEnd;
+            }
+        }
+    }
+
+    shared.mLock.Unlock();
+
+    if (block == nullptr) {
+        block = FallbackAlloc(cls);
+    }
+
+    return block;
+}
+
+// Returns everything a finishing thread still holds to the shared lists so other threads can reuse it.
+void FlushThreadCache()
+{
+    for (unsigned cls = 0; cls < kClassCount; ++cls) {
+        ClassCache &cache = tCache.mClasses[cls];
+
+        while (cache.mpBump != cache.mpBumpEnd) {
+            FreeBlock *block = reinterpret_cast<FreeBlock *>(cache.mpBump);
+            block->mpNext = cache.mpHead;
+            cache.mpHead = block;
+            ++cache.mnCount;
+            cache.mpBump += ClassSize(cls);
+
+            if (size_t(cache.mpBumpEnd - cache.mpBump) < ClassSize(cls)) {
+                cache.mpBump = cache.mpBumpEnd;
+            }
+        }
+
+        if (cache.mpHead != nullptr) {
+            FreeBlock *tail = cache.mpHead;
+
+            while (tail->mpNext != nullptr) {
+                tail = tail->mpNext;
+            }
+
+            GiveShared(cls, cache.mpHead, tail, cache.mnCount);
+            cache.mpHead = nullptr;
+            cache.mnCount = 0;
+        }
+    }
+}
+
+struct ThreadCacheGuard
+{
+    ~ThreadCacheGuard()
+    {
+        FlushThreadCache();
+        tCacheState = CACHE_FINISHED;
+    }
+};
+
+ThreadCache *GetThreadCache()
+{
+    if (tCacheState == CACHE_LIVE) {
+        return &tCache;
+    }
+
+    if (tCacheState == CACHE_FINISHED) {
+        return nullptr;
+    }
+
+    // Touching the guard registers its destructor to run when this thread exits.
+    static thread_local ThreadCacheGuard guard;
+    (void)guard;
+    tCacheState = CACHE_LIVE;
+
+    return &tCache;
+}
+
+void *RefillAlloc(ClassCache &cache, unsigned cls)
+{
+    if (cache.mpBump == cache.mpBumpEnd) {
+        uint32_t count;
+        FreeBlock *head = TakeShared(cls, kBatchCount, count);
+
+        if (head != nullptr) {
+            cache.mpHead = head->mpNext;
+            cache.mnCount = count - 1;
+
+            return head;
+        }
+
+        cache.mpBump = AllocChunk(cls);
+
+        if (cache.mpBump == nullptr) {
+            cache.mpBumpEnd = nullptr;
+            return FallbackAlloc(cls);
+        }
+
+        cache.mpBumpEnd = cache.mpBump + kChunkSize;
+    }
+
+    void *block = cache.mpBump;
+    cache.mpBump += ClassSize(cls);
+
+    // Chunks don't always divide evenly, the tail is simply left unused.
+    if (size_t(cache.mpBumpEnd - cache.mpBump) < ClassSize(cls)) {
+        cache.mpBump = cache.mpBumpEnd;
+    }
+
+    return block;
+}
+
+void FreeSmall(void *pMem, unsigned cls)
+{
+    FreeBlock *block = static_cast<FreeBlock *>(pMem);
+    ThreadCache *thread_cache = GetThreadCache();
+
+    if (thread_cache == nullptr) {
+        GiveShared(cls, block, block, 1);
+        return;
+    }
+
+    ClassCache &cache = thread_cache->mClasses[cls];
+    block->mpNext = cache.mpHead;
+    cache.mpHead = block;
+
+    if (++cache.mnCount > kCacheLimit) {
+        FreeBlock *tail = cache.mpHead;
+
+        for (uint32_t i = 1; i < kBatchCount; ++i) {
+            tail = tail->mpNext;
+        }
+
+        FreeBlock *head = cache.mpHead;
+        cache.mpHead = tail->mpNext;
+        cache.mnCount -= kBatchCount;
+        GiveShared(cls, head, tail, kBatchCount);
+    }
+}
+
+void *AllocBlock(size_t nCount)
+{
+    if (nCount > kMaxSmallSize) {
+        return std::malloc(nCount);
+    }
+
+    unsigned cls = SizeClass(nCount);
+    ThreadCache *thread_cache = GetThreadCache();
+
+    if (thread_cache == nullptr) {
+        return SharedAlloc(cls);
+    }
+
+    ClassCache &cache = thread_cache->mClasses[cls];
+    FreeBlock *block = cache.mpHead;
+
+    if (block != nullptr) {
+        cache.mpHead = block->mpNext;
+        --cache.mnCount;
+
+        return block;
+    }
+
+    return RefillAlloc(cache, cls);
+}
+
+// Instrumentation, while it is off the only cost is a relaxed load per call.
+constexpr unsigned kLargeClass = kClassCount;
+constexpr size_t kSampleTableSize = 4096;
+
+struct ClassCounters
+{
+    std::atomic<uint64_t> mnAllocCount;
+    std::atomic<uint64_t> mnFreeCount;
+    std::atomic<int64_t> mnBytesInUse;
+    std::atomic<int64_t> mnPeakBytes;
+};
+
+struct Sample
+{
+    void *mpMem;
+    size_t mnCount;
+    int mnFrames;
+    void *mpFrames[kRZFastAllocMaxFrames];
+};
+
+std::atomic<bool> gTracking;
+std::atomic<uint32_t> gSampleRate;
+ClassCounters gCounters[kRZFastAllocClassCount];
+std::atomic<int64_t> gBytesInUse;
+std::atomic<int64_t> gPeakBytes;
+
+SpinLock gSampleLock;
+Sample *gSamples;
+std::atomic<uint32_t> gSampleCount;
+
+thread_local uint32_t tSampleCountdown;
+
+void RaisePeak(std::atomic<int64_t> &peak, int64_t value)
+{
+    int64_t current = peak.load(std::memory_order_relaxed);
+
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+// System heap blocks are counted at their usable size so that allocation and free always agree.
+inline unsigned TrackedClass(void *pMem, size_t &nSize)
+{
+    int cls = ChunkClass(pMem);
+
+    if (cls < 0) {
+        nSize = SystemBlockSize(pMem);
+        return kLargeClass;
+    }
+
+    nSize = ClassSize(unsigned(cls));
+
+    return unsigned(cls);
+}
+
+inline size_t SampleSlot(const void *pMem)
+{
+    return size_t((uint64_t(uintptr_t(pMem) >> 4) * 0x9E3779B97F4A7C15ull) >> 32) & (kSampleTableSize - 1);
+}
+
+int CaptureFrames(void **ppFrames)
+{
+#ifdef _WIN32
+    return CaptureStackBackTrace(2, kRZFastAllocMaxFrames, ppFrames, nullptr);
+#elif defined HAVE_EXECINFO_H
+    return backtrace(ppFrames, kRZFastAllocMaxFrames);
+#else
+    return 0;
+#endif
+}
+
+void AddSample(void *pMem, size_t nCount)
+{
+    Sample sample;
+    sample.mpMem = pMem;
+    sample.mnCount = nCount;
+    sample.mnFrames = CaptureFrames(sample.mpFrames);
+
+    gSampleLock.Lock();
+
+    if (gSamples == nullptr) {
+        gSamples = static_cast<Sample *>(std::calloc(kSampleTableSize, sizeof(Sample)));
+    }
+
+    // The table is kept sparse enough for short probe sequences, samples beyond that are dropped.
+    if (gSamples != nullptr && gSampleCount.load(std::memory_order_relaxed) < kSampleTableSize * 3 / 4) {
+        size_t slot = SampleSlot(pMem);
+
+        while (gSamples[slot].mpMem != nullptr) {
+            slot = (slot + 1) & (kSampleTableSize - 1);
+        }
+
+        gSamples[slot] = sample;
+        gSampleCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    gSampleLock.Unlock();
+}
+
+void RemoveSample(void *pMem)
+{
+    const size_t mask = kSampleTableSize - 1;
+
+    gSampleLock.Lock();
+
+    if (gSamples != nullptr) {
+        size_t slot = SampleSlot(pMem);
+
+        while (gSamples[slot].mpMem != nullptr && gSamples[slot].mpMem != pMem) {
+            slot = (slot + 1) & mask;
+        }
+
+        if (gSamples[slot].mpMem == pMem) {
+            // Shift later members of the probe sequence back so that lookups never stop early at the hole.
+            size_t hole = slot;
+
+            for (size_t next = (hole + 1) & mask; gSamples[next].mpMem != nullptr; next = (next + 1) & mask) {
+                size_t home = SampleSlot(gSamples[next].mpMem);
+
+                if (((next - home) & mask) >= ((next - hole) & mask)) {
+                    gSamples[hole] = gSamples[next];
+                    hole = next;
+                }
+            }
+
+            gSamples[hole].mpMem = nullptr;
+            gSampleCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    gSampleLock.Unlock();
+}
+
+void TrackAlloc(void *pMem, size_t nCount)
+{
+    size_t size;
+    ClassCounters &counters = gCounters[TrackedClass(pMem, size)];
+
+    counters.mnAllocCount.fetch_add(1, std::memory_order_relaxed);
+    RaisePeak(counters.mnPeakBytes, counters.mnBytesInUse.fetch_add(size, std::memory_order_relaxed) + int64_t(size));
+    RaisePeak(gPeakBytes, gBytesInUse.fetch_add(size, std::memory_order_relaxed) + int64_t(size));
+
+    uint32_t rate = gSampleRate.load(std::memory_order_relaxed);
+
+    if (rate != 0) {
+        if (tSampleCountdown == 0 || tSampleCountdown > rate) {
+            tSampleCountdown = rate;
+        }
+
+        if (--tSampleCountdown == 0) {
+            AddSample(pMem, nCount);
+        }
+    }
+}
+
+// Samples are removed even with tracking off so a stale entry can never be matched against a reused address.
+void TrackFree(void *pMem)
+{
+    if (gSampleCount.load(std::memory_order_relaxed) != 0) {
+        RemoveSample(pMem);
+    }
+
+    if (gTracking.load(std::memory_order_relaxed)) {
+        size_t size;
+        ClassCounters &counters = gCounters[TrackedClass(pMem, size)];
+
+        counters.mnFreeCount.fetch_add(1, std::memory_order_relaxed);
+        counters.mnBytesInUse.fetch_sub(size, std::memory_order_relaxed);
+        gBytesInUse.fetch_sub(size, std::memory_order_relaxed);
+    }
+}
+
+inline bool TrackingFrees()
+{
+    return gTracking.load(std::memory_order_relaxed) || gSampleCount.load(std::memory_order_relaxed) != 0;
+}
+
+} // namespace
+
+void *RZFastAlloc(size_t nCount)
+{
+    void *block = AllocBlock(nCount);
+
+    if (block != nullptr && gTracking.load(std::memory_order_relaxed)) {
+        TrackAlloc(block, nCount);
+    }
+
+    return block;
+}
+
+void RZFastFree(void *pvMem)
+{
+    if (pvMem == nullptr) {
+        return;
+    }
+
+    if (TrackingFrees()) {
+        TrackFree(pvMem);
+    }
+
+    int cls = ChunkClass(pvMem);
+
+    if (cls < 0) {
+        std::free(pvMem);
+        return;
+    }
+
+    FreeSmall(pvMem, unsigned(cls));
+}
+
+void RZFastFreeSized(void *pvMem, size_t nCount)
+{
+    if (pvMem == nullptr) {
+        return;
+    }
+
+    if (TrackingFrees()) {
+        TrackFree(pvMem);
+    }
+
+    // The size alone says where the block came from unless small blocks have ever fallen back to the system heap.
+    if (nCount > kMaxSmallSize || (gSmallFallback.load(std::memory_order_relaxed) && ChunkClass(pvMem) < 0)) {
+        std::free(pvMem);
+        return;
+    }
+
+    FreeSmall(pvMem, SizeClass(nCount));
+}
+
+void *RZFastRealloc(void *pvMem, size_t nCount)
+{
+    if (pvMem == nullptr) {
+        return RZFastAlloc(nCount);
+    }
+
+    int cls = ChunkClass(pvMem);
+
+    if (cls < 0) {
+        // Shrinking into the pool range moves the block so small blocks are pooled whenever possible.
+        if (nCount <= kMaxSmallSize) {
+            size_t old_size = SystemBlockSize(pvMem);
+            void *mem = RZFastAlloc(nCount);
+
+            if (mem != nullptr) {
+                std::memcpy(mem, pvMem, nCount < old_size ? nCount : old_size);
+                RZFastFree(pvMem);
+            }
+
+            return mem;
+        }
+
+        if (!TrackingFrees()) {
+            return std::realloc(pvMem, nCount);
+        }
+
+        TrackFree(pvMem);
+        void *mem = std::realloc(pvMem, nCount);
+
+        // A failed realloc leaves the original block allocated so it goes back into the counters.
+        if (gTracking.load(std::memory_order_relaxed)) {
+            TrackAlloc(mem != nullptr ? mem : pvMem, nCount);
+        }
+
+        return mem;
+    }
+
+    size_t old_size = ClassSize(unsigned(cls));
+
+    if (nCount <= old_size && SizeClass(nCount) == unsigned(cls)) {
+        return pvMem;
+    }
+
+    void *mem = RZFastAlloc(nCount);
+
+    if (mem != nullptr) {
+        std::memcpy(mem, pvMem, nCount < old_size ? nCount : old_size);
+        RZFastFree(pvMem);
+    }
+
+    return mem;
+}
+
+void RZFastAllocSetTracking(bool bEnable, uint32_t nSampleRate)
+{
+    gSampleRate.store(bEnable ? nSampleRate : 0, std::memory_order_relaxed);
+    gTracking.store(bEnable, std::memory_order_relaxed);
+}
+
+bool RZFastAllocGetStats(RZFastAllocStats &stats)
+{
+    std::memset(&stats, 0, sizeof(stats));
+
+    if (!gTracking.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    for (int i = 0; i < kRZFastAllocClassCount; ++i) {
+        stats.mClasses[i].mnAllocCount = gCounters[i].mnAllocCount.load(std::memory_order_relaxed);
+        stats.mClasses[i].mnFreeCount = gCounters[i].mnFreeCount.load(std::memory_order_relaxed);
+        stats.mClasses[i].mnBytesInUse = gCounters[i].mnBytesInUse.load(std::memory_order_relaxed);
+        stats.mClasses[i].mnPeakBytes = gCounters[i].mnPeakBytes.load(std::memory_order_relaxed);
+    }
+
+    stats.mnBytesInUse = gBytesInUse.load(std::memory_order_relaxed);
+    stats.mnPeakBytes = gPeakBytes.load(std::memory_order_relaxed);
+
+    return true;
+}
+
+uint32_t RZFastAllocEnumSamples(RZFastAllocSampleCallback pCallback, void *pContext)
+{
+    uint32_t count = 0;
+    Sample *samples = nullptr;
+
+    // Copied out first so that the callback is free to allocate and free.
+    gSampleLock.Lock();
+
+    if (gSamples != nullptr && gSampleCount.load(std::memory_order_relaxed) != 0) {
+        samples = static_cast<Sample *>(std::malloc(sizeof(Sample) * gSampleCount.load(std::memory_order_relaxed)));
+
+        for (size_t i = 0; samples != nullptr && i < kSampleTableSize; ++i) {
+            if (gSamples[i].mpMem != nullptr) {
+                samples[count++] = gSamples[i];
+            }
+        }
+    }
+
+    gSampleLock.Unlock();
+
+    for (uint32_t i = 0; i < count; ++i) {
+        pCallback(samples[i].mpMem, samples[i].mnCount, samples[i].mpFrames, samples[i].mnFrames, pContext);
+    }
+
+    std::free(samples);
+
+    return count;
+}
+#endif
+
+void RZFastAllocDiffStats(const RZFastAllocStats &before, const RZFastAllocStats &after, RZFastAllocStats &diff)
+{
+    for (int i = 0; i < kRZFastAllocClassCount; ++i) {
+        diff.mClasses[i].mnAllocCount = after.mClasses[i].mnAllocCount - before.mClasses[i].mnAllocCount;
+        diff.mClasses[i].mnFreeCount = after.mClasses[i].mnFreeCount - before.mClasses[i].mnFreeCount;
+        diff.mClasses[i].mnBytesInUse = after.mClasses[i].mnBytesInUse - before.mClasses[i].mnBytesInUse;
+        diff.mClasses[i].mnPeakBytes = after.mClasses[i].mnPeakBytes;
+    }
+
+    diff.mnBytesInUse = after.mnBytesInUse - before.mnBytesInUse;
+    diff.mnPeakBytes = after.mnPeakBytes;
+}
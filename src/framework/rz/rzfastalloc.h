@@ -18,16 +18,66 @@
 
 void *RZFastAlloc(size_t nCount);
 void RZFastFree(void *pvMem);
+/**
+ * @brief Frees a block when the caller still knows the size it was allocated or last reallocated with.
+ */
+void RZFastFreeSized(void *pvMem, size_t nCount);
 void *RZFastRealloc(void *pvMem, size_t nCount);
 
+enum
+{
+    kRZFastAllocSmallClasses = 16, // Blocks up to 256 bytes in steps of 16.
+    kRZFastAllocClassCount = kRZFastAllocSmallClasses + 1, // Last class counts blocks from the system heap.
+    kRZFastAllocMaxFrames = 16,
+};
+
+struct RZFastAllocClassStats
+{
+    uint64_t mnAllocCount;
+    uint64_t mnFreeCount;
+    int64_t mnBytesInUse;
+    int64_t mnPeakBytes;
+};
+
+struct RZFastAllocStats
+{
+    RZFastAllocClassStats mClasses[kRZFastAllocClassCount];
+    int64_t mnBytesInUse;
+    int64_t mnPeakBytes;
+};
+
+typedef void (*RZFastAllocSampleCallback)(void *pvMem, size_t nCount, void *const *ppFrames, int nFrames, void *pContext);
+
+/**
+ * @brief Turns allocation tracking on or off.
+ * @param bEnable Whether to count allocations, should be enabled early as blocks allocated before are not counted.
+ * @param nSampleRate Capture the call stack of every nth allocation, 0 to disable sampling.
+ */
+void RZFastAllocSetTracking(bool bEnable, uint32_t nSampleRate = 0);
+/**
+ * @brief Takes a snapshot of the allocation counters.
+ * @return False if tracking is not available or not enabled, stats is zeroed in that case.
+ */
+bool RZFastAllocGetStats(RZFastAllocStats &stats);
+/**
+ * @brief Computes the change between two snapshots, peaks are taken from the later snapshot.
+ */
+void RZFastAllocDiffStats(const RZFastAllocStats &before, const RZFastAllocStats &after, RZFastAllocStats &diff);
+/**
+ * @brief Calls the callback for each sampled allocation that has not been freed yet.
+ * @return Number of samples visited.
+ */
+uint32_t RZFastAllocEnumSamples(RZFastAllocSampleCallback pCallback, void *pContext);
+
 /**
  * @brief A STL allocator that uses the game's memory pool
  *
  * This is an allocator for STL containers like lists and sets which uses the
  * game's built-in memory allocator, macOS version appears to just use malloc
- * and friends for this.
+ * and friends for this. The allocator is stateless so all instances compare
+ * equal and containers can move their storage between each other.
  */
-template<typename T> class cRZFastSTLAllocator : public std::allocator<T>
+template<typename T> class cRZFastSTLAllocator
 {
 public:
     typedef T value_type;
@@ -37,6 +87,8 @@ public:
     typedef const T &const_reference;
     typedef size_t size_type;
     typedef ptrdiff_t difference_type;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type is_always_equal;
 
     template<class U> struct rebind
     {
@@ -50,13 +102,26 @@ public:
 
     pointer allocate(size_type nCount) { return (pointer)(RZFastAlloc(sizeof(T) * nCount)); }
     pointer allocate(size_type nCount, void const *pHint) { return allocate(nCount); }
-    void deallocate(pointer pElem, size_type nCount) { RZFastFree((void *)pElem); }
+    void deallocate(pointer pElem, size_type nCount) { RZFastFreeSized((void *)pElem, sizeof(T) * nCount); }
+#ifdef MATCH_ABI
+    // STLPort predates std::allocator_traits and calls these directly.
     void construct(pointer pElem, const_reference sValue) { new (pElem) T(sValue); }
     void destroy(pointer pElem) { pElem->~T(); }
 
-    cRZFastSTLAllocator<T> &operator=(const cRZFastSTLAllocator &) { return *this; }
-    size_type max_size() const { return size_t(-1); }
-
     pointer address(reference sValue) { return &sValue; }
     const_pointer address(const_reference sValue) const { return &sValue; }
+#endif
+
+    cRZFastSTLAllocator<T> &operator=(const cRZFastSTLAllocator &) { return *this; }
+    size_type max_size() const { return size_t(-1) / sizeof(T); }
 };
+
+template<typename T, typename U> bool operator==(const cRZFastSTLAllocator<T> &, const cRZFastSTLAllocator<U> &)
+{
+    return true;
+}
+
+template<typename T, typename U> bool operator!=(const cRZFastSTLAllocator<T> &, const cRZFastSTLAllocator<U> &)
+{
+    return false;
+}
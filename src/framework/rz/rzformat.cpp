@@ -0,0 +1,230 @@
+/**
+ * @file
+ *
+ * @brief Type safe string formatting using {} placeholders.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzformat.h"
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+struct FormatSpec
+{
+    bool mbZeroFill;
+    size_t mnWidth;
+    int mnPrecision;
+    char mType;
+};
+
+// Parses the text between the colon and closing brace, returns a pointer to the closing brace or null if malformed.
+const char *ParseSpec(const char *pszSpec, FormatSpec &spec)
+{
+    spec.mbZeroFill = false;
+    spec.mnWidth = 0;
+    spec.mnPrecision = -1;
+    spec.mType = '\0';
+
+    if (*pszSpec != ':') {
+        return *pszSpec == '}' ? pszSpec : nullptr;
+    }
+
+    ++pszSpec;
+
+    if (*pszSpec == '0') {
+        spec.mbZeroFill = true;
+        ++pszSpec;
+    }
+
+    while (*pszSpec >= '0' && *pszSpec <= '9') {
+        spec.mnWidth = spec.mnWidth * 10 + (*pszSpec++ - '0');
+    }
+
+    if (*pszSpec == '.') {
+        spec.mnPrecision = 0;
+        ++pszSpec;
+
+        while (*pszSpec >= '0' && *pszSpec <= '9') {
+            spec.mnPrecision = spec.mnPrecision * 10 + (*pszSpec++ - '0');
+        }
+    }
+
+    if (*pszSpec != '}' && *pszSpec != '\0') {
+        spec.mType = *pszSpec++;
+    }
+
+    return *pszSpec == '}' ? pszSpec : nullptr;
+}
+
+class cFormatter
+{
+public:
+    cFormatter(RZFormatAppendFunc pAppend, void *pContext) : mpAppend(pAppend), mpContext(pContext) {}
+
+    void Append(const char *pszText, size_t nLength)
+    {
+        if (nLength != 0) {
+            mpAppend(mpContext, pszText, nLength);
+        }
+    }
+
+    void Pad(char cFill, size_t nCount)
+    {
+        char fill[16];
+        std::memset(fill, cFill, sizeof(fill));
+
+        for (; nCount > sizeof(fill); nCount -= sizeof(fill)) {
+            Append(fill, sizeof(fill));
+        }
+
+        Append(fill, nCount);
+    }
+
+    // Numbers are right aligned, zero filling goes between the sign or prefix and the digits.
+    void Number(const char *pszPrefix, size_t nPrefixLen, const char *pszDigits, size_t nDigitLen, const FormatSpec &spec)
+    {
+        size_t len = nPrefixLen + nDigitLen;
+        size_t pad = spec.mnWidth > len ? spec.mnWidth - len : 0;
+
+        if (spec.mbZeroFill) {
+            Append(pszPrefix, nPrefixLen);
+            Pad('0', pad);
+        } else {
+            Pad(' ', pad);
+            Append(pszPrefix, nPrefixLen);
+        }
+
+        Append(pszDigits, nDigitLen);
+    }
+
+    void Integer(uint64_t nValue, const char *pszPrefix, const FormatSpec &spec)
+    {
+        char digits[24];
+        char *end = digits + sizeof(digits);
+        char *start = end;
+
+        if (spec.mType == 'x' || spec.mType == 'X') {
+            const char *hex = spec.mType == 'x' ? "0123456789abcdef" : "0123456789ABCDEF";
+
+            do {
+                *--start = hex[nValue & 0xF];
+                nValue >>= 4;
+            } while (nValue != 0);
+        } else {
+            do {
+                *--start = char('0' + nValue % 10);
+                nValue /= 10;
+            } while (nValue != 0);
+        }
+
+        Number(pszPrefix, std::strlen(pszPrefix), start, end - start, spec);
+    }
+
+    void Double(double fValue, const FormatSpec &spec)
+    {
+        char format[8] = { '%', '.', '*', spec.mType == 'f' || spec.mType == 'e' ? spec.mType : 'g', '\0' };
+        char digits[64];
+        int len = std::snprintf(digits, sizeof(digits), format, spec.mnPrecision < 0 ? 6 : spec.mnPrecision, fValue);
+
+        // Values too large for the buffer, such as huge numbers with fixed notation, fall back to exponent form.
+        if (len < 0 || len >= int(sizeof(digits))) {
+            len = std::snprintf(digits, sizeof(digits), "%g", fValue);
+        }
+
+        bool negative = digits[0] == '-';
+        Number("-", negative ? 1 : 0, digits + negative, len - negative, spec);
+    }
+
+    void String(const char *pszData, size_t nLength, const FormatSpec &spec)
+    {
+        if (spec.mnPrecision >= 0 && size_t(spec.mnPrecision) < nLength) {
+            nLength = spec.mnPrecision;
+        }
+
+        Append(pszData, nLength);
+        Pad(' ', spec.mnWidth > nLength ? spec.mnWidth - nLength : 0);
+    }
+
+    void Argument(const RZFormatArg &arg, const FormatSpec &spec)
+    {
+        switch (arg.mType) {
+            case RZFormatArg::TYPE_INT:
+                Integer(arg.mnInt < 0 ? 0 - uint64_t(arg.mnInt) : uint64_t(arg.mnInt), arg.mnInt < 0 ? "-" : "", spec);
+                break;
+            case RZFormatArg::TYPE_UINT:
+                Integer(arg.mnUInt, "", spec);
+                break;
+            case RZFormatArg::TYPE_DOUBLE:
+                Double(arg.mfDouble, spec);
+                break;
+            case RZFormatArg::TYPE_CHAR: {
+                char c = char(arg.mnUInt);
+                String(&c, 1, spec);
+            } break;
+            case RZFormatArg::TYPE_BOOL:
+                String(arg.mnUInt ? "true" : "false", arg.mnUInt ? 4 : 5, spec);
+                break;
+            case RZFormatArg::TYPE_STRING:
+                String(arg.mString.mpData, arg.mString.mnLength, spec);
+                break;
+            case RZFormatArg::TYPE_POINTER: {
+                FormatSpec hex = spec;
+                hex.mType = 'x';
+                Integer(uint64_t(uintptr_t(arg.mpPointer)), "0x", hex);
+            } break;
+            default:
+                break;
+        }
+    }
+
+private:
+    RZFormatAppendFunc mpAppend;
+    void *mpContext;
+};
+} // namespace
+
+void RZFormatAppend(RZFormatAppendFunc pAppend, void *pContext, const char *pszFormat, const RZFormatArg *pArgs, size_t nArgs)
+{
+    cFormatter formatter(pAppend, pContext);
+    size_t next_arg = 0;
+    const char *literal = pszFormat;
+    const char *getp = pszFormat;
+
+    while (*getp != '\0') {
+        if ((getp[0] == '{' && getp[1] == '{') || (getp[0] == '}' && getp[1] == '}')) {
+            // Emit the text so far including one brace of the pair.
+            formatter.Append(literal, getp - literal + 1);
+            getp += 2;
+            literal = getp;
+        } else if (getp[0] == '{') {
+            FormatSpec spec;
+            const char *close = ParseSpec(getp + 1, spec);
+
+            // A lone brace that doesn't start a valid placeholder is kept as text.
+            if (close == nullptr) {
+                ++getp;
+                continue;
+            }
+
+            formatter.Append(literal, getp - literal);
+
+            if (next_arg < nArgs) {
+                formatter.Argument(pArgs[next_arg++], spec);
+            }
+
+            getp = close + 1;
+            literal = getp;
+        } else {
+            ++getp;
+        }
+    }
+
+    formatter.Append(literal, getp - literal);
+}
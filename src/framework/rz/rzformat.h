@@ -0,0 +1,188 @@
+/**
+ * @file
+ *
+ * @brief Type safe string formatting using {} placeholders.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+#include "igzstring.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief A single formatting argument with its type recorded so the formatter never relies on varargs.
+ */
+struct RZFormatArg
+{
+    enum Type
+    {
+        TYPE_INT,
+        TYPE_UINT,
+        TYPE_DOUBLE,
+        TYPE_CHAR,
+        TYPE_BOOL,
+        TYPE_STRING,
+        TYPE_POINTER,
+    };
+
+    Type mType;
+
+    union
+    {
+        int64_t mnInt;
+        uint64_t mnUInt;
+        double mfDouble;
+        const void *mpPointer;
+        struct
+        {
+            const char *mpData;
+            size_t mnLength;
+        } mString;
+    };
+};
+
+typedef void (*RZFormatAppendFunc)(void *pContext, const char *pszText, size_t nLength);
+
+/**
+ * @brief Formats into whatever the append function writes to, see RZFormatTo.
+ */
+void RZFormatAppend(RZFormatAppendFunc pAppend, void *pContext, const char *pszFormat, const RZFormatArg *pArgs, size_t nArgs);
+
+/**
+ * @brief Counts the placeholders in a format string, usable in constant expressions to check argument counts.
+ */
+constexpr size_t RZFormatArgCount(const char *pszFormat)
+{
+    size_t count = 0;
+
+    for (; *pszFormat != '\0'; ++pszFormat) {
+        if ((pszFormat[0] == '{' && pszFormat[1] == '{') || (pszFormat[0] == '}' && pszFormat[1] == '}')) {
+            ++pszFormat;
+        } else if (pszFormat[0] == '{') {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+namespace RZFormatDetail
+{
+// Types without an overload here fail to compile, convert them to a string or number first.
+template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type>
+RZFormatArg MakeArg(const T &value)
+{
+    RZFormatArg arg;
+
+    if constexpr (std::is_floating_point<T>::value) {
+        arg.mType = RZFormatArg::TYPE_DOUBLE;
+        arg.mfDouble = double(value);
+    } else if constexpr (std::is_signed<T>::value) {
+        arg.mType = RZFormatArg::TYPE_INT;
+        arg.mnInt = int64_t(value);
+    } else {
+        arg.mType = RZFormatArg::TYPE_UINT;
+        arg.mnUInt = uint64_t(value);
+    }
+
+    return arg;
+}
+
+inline RZFormatArg MakeArg(bool value)
+{
+    RZFormatArg arg;
+    arg.mType = RZFormatArg::TYPE_BOOL;
+    arg.mnUInt = value;
+
+    return arg;
+}
+
+inline RZFormatArg MakeArg(char value)
+{
+    RZFormatArg arg;
+    arg.mType = RZFormatArg::TYPE_CHAR;
+    arg.mnUInt = (unsigned char)value;
+
+    return arg;
+}
+
+inline RZFormatArg MakeStringArg(const char *pszData, size_t nLength)
+{
+    RZFormatArg arg;
+    arg.mType = RZFormatArg::TYPE_STRING;
+    arg.mString.mpData = pszData;
+    arg.mString.mnLength = nLength;
+
+    return arg;
+}
+
+inline RZFormatArg MakeArg(const char *value)
+{
+    return value != nullptr ? MakeStringArg(value, std::char_traits<char>::length(value)) : MakeStringArg("(null)", 6);
+}
+
+inline RZFormatArg MakeArg(char *value)
+{
+    return MakeArg(static_cast<const char *>(value));
+}
+
+inline RZFormatArg MakeArg(const cIGZString &value)
+{
+    return MakeStringArg(value.Data(), value.Strlen());
+}
+
+template<typename Traits, typename Alloc> RZFormatArg MakeArg(const std::basic_string<char, Traits, Alloc> &value)
+{
+    return MakeStringArg(value.data(), value.size());
+}
+
+template<typename T> RZFormatArg MakeArg(T *value)
+{
+    RZFormatArg arg;
+    arg.mType = RZFormatArg::TYPE_POINTER;
+    arg.mpPointer = value;
+
+    return arg;
+}
+
+template<typename... Args> std::integral_constant<size_t, sizeof...(Args)> CountArgs(const Args &...);
+
+template<typename String> void AppendTo(void *pContext, const char *pszText, size_t nLength)
+{
+    static_cast<String *>(pContext)->append(pszText, nLength);
+}
+} // namespace RZFormatDetail
+
+/**
+ * @brief Appends formatted text to any string type that provides append(const char *, size_t).
+ *
+ * Each {} is replaced by the next argument and {{ or }} produce a literal brace. A placeholder can carry a spec
+ * after a colon made up of an optional 0 fill flag, a width, a .precision and a type character. Types are x and X
+ * for hex integers, f, e and g for floating point values. Numbers are right aligned and strings left aligned within
+ * the width, precision truncates strings. Placeholders without a matching argument are left out.
+ */
+template<typename String, typename... Args> String &RZFormatTo(String &sTarget, const char *pszFormat, const Args &...args)
+{
+    const RZFormatArg packed[] = { RZFormatDetail::MakeArg(args)..., RZFormatArg() };
+    RZFormatAppend(RZFormatDetail::AppendTo<String>, &sTarget, pszFormat, packed, sizeof...(args));
+
+    return sTarget;
+}
+
+/**
+ * @brief Checks at compile time that a literal format string has a placeholder for every argument then formats it.
+ */
+#define RZ_FORMAT_TO(target, format, ...) \
+    ([&]() -> auto & { \
+        static_assert(RZFormatArgCount(format) == decltype(RZFormatDetail::CountArgs(__VA_ARGS__))::value, \
+            "Format placeholders don't match the number of arguments"); \
+        return RZFormatTo(target, format, __VA_ARGS__); \
+    }())
@@ -0,0 +1,68 @@
+/**
+ * @file
+ *
+ * @brief Helpers for sleeping on an atomic word, shared by the POSIX synchronisation primitives.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+
+#include <atomic>
+#include <sched.h>
+#include <stdint.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Hints to the processor that the thread is spinning.
+ */
+inline void RZCpuRelax()
+{
+#if defined __x86_64__ || defined __i386__
+    __builtin_ia32_pause();
+#elif defined __aarch64__ || defined __arm__
+    __asm__ __volatile__("yield");
+#endif
+}
+
+#ifdef __linux__
+/**
+ * @brief Sleeps until the word is woken, returns straight away if the word no longer holds the value. Can also return
+ * spuriously so callers must check the word again.
+ * @param word Word to sleep on.
+ * @param value Value the word is expected to hold.
+ */
+inline void RZFutexWait(std::atomic<uint32_t> &word, uint32_t value)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+}
+
+/**
+ * @brief Wakes threads sleeping on the word.
+ * @param word Word threads are sleeping on.
+ * @param count Maximum number of threads to wake.
+ */
+inline void RZFutexWake(std::atomic<uint32_t> &word, int count)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+#else
+// Without futexes a waiter gives up its time slice and checks again rather than keeping a kernel object per word.
+inline void RZFutexWait(std::atomic<uint32_t> &word, uint32_t value)
+{
+    if (word.load(std::memory_order_relaxed) == value) {
+        sched_yield();
+    }
+}
+
+inline void RZFutexWake(std::atomic<uint32_t> &, int) {}
+#endif
@@ -0,0 +1,153 @@
+/**
+ * @file
+ *
+ * @brief Fast non-cryptographic string hashing and hash container support for strings.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzhash.h"
+#include <cstring>
+
+#if defined _MSC_VER && defined _M_X64
+#include <intrin.h>
+#endif
+
+namespace
+{
+const uint64_t kSecret[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+// 64x64 to 128 bit multiply, leaving the low half in a and the high half in b.
+inline void Multiply(uint64_t &a, uint64_t &b)
+{
+#if defined __SIZEOF_INT128__
+    __uint128_t r = __uint128_t(a) * b;
+    a = uint64_t(r);
+    b = uint64_t(r >> 64);
+#elif defined _MSC_VER && defined _M_X64
+    a = _umul128(a, b, &b);
+#else
+    uint64_t ha = a >> 32;
+    uint64_t hb = b >> 32;
+    uint64_t la = uint32_t(a);
+    uint64_t lb = uint32_t(b);
+    uint64_t rh = ha * hb;
+    uint64_t rm0 = ha * lb;
+    uint64_t rm1 = hb * la;
+    uint64_t rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline uint64_t Mix(uint64_t a, uint64_t b)
+{
+    Multiply(a, b);
+    return a ^ b;
+}
+
+// Folds ASCII upper case letters in every byte lane at once, bytes of 0x80 and up are left alone.
+inline uint64_t FoldLanes(uint64_t value)
+{
+    const uint64_t ones = 0x0101010101010101ull;
+    uint64_t low7 = value & (ones * 0x7F);
+    uint64_t above_z = low7 + ones * (0x7F - 'Z');
+    uint64_t from_a = low7 + ones * (0x80 - 'A');
+    uint64_t upper = from_a & ~above_z & ~value & (ones * 0x80);
+
+    return value | (upper >> 2);
+}
+
+template<bool Fold> inline uint64_t Read8(const unsigned char *p)
+{
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return Fold ? FoldLanes(value) : value;
+}
+
+template<bool Fold> inline uint64_t Read4(const unsigned char *p)
+{
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return Fold ? FoldLanes(value) : value;
+}
+
+template<bool Fold> inline uint64_t Read3(const unsigned char *p, size_t k)
+{
+    uint64_t value = (uint64_t(p[0]) << 16) | (uint64_t(p[k >> 1]) << 8) | p[k - 1];
+    return Fold ? FoldLanes(value) : value;
+}
+
+template<bool Fold> uint64_t Hash(const void *pData, size_t nLength, uint64_t nSeed)
+{
+    const unsigned char *p = static_cast<const unsigned char *>(pData);
+    uint64_t a;
+    uint64_t b;
+
+    nSeed ^= Mix(nSeed ^ kSecret[0], kSecret[1]);
+
+    if (nLength <= 16) {
+        if (nLength >= 4) {
+            a = (Read4<Fold>(p) << 32) | Read4<Fold>(p + ((nLength >> 3) << 2));
+            b = (Read4<Fold>(p + nLength - 4) << 32) | Read4<Fold>(p + nLength - 4 - ((nLength >> 3) << 2));
+        } else if (nLength > 0) {
+            a = Read3<Fold>(p, nLength);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t i = nLength;
+
+        // Three independent lanes keep the multipliers busy on long keys such as full resource paths.
+        if (i > 48) {
+            uint64_t see1 = nSeed;
+            uint64_t see2 = nSeed;
+
+            do {
+                nSeed = Mix(Read8<Fold>(p) ^ kSecret[1], Read8<Fold>(p + 8) ^ nSeed);
+                see1 = Mix(Read8<Fold>(p + 16) ^ kSecret[2], Read8<Fold>(p + 24) ^ see1);
+                see2 = Mix(Read8<Fold>(p + 32) ^ kSecret[3], Read8<Fold>(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+
+            nSeed ^= see1 ^ see2;
+        }
+
+        while (i > 16) {
+            nSeed = Mix(Read8<Fold>(p) ^ kSecret[1], Read8<Fold>(p + 8) ^ nSeed);
+            i -= 16;
+            p += 16;
+        }
+
+        a = Read8<Fold>(p + i - 16);
+        b = Read8<Fold>(p + i - 8);
+    }
+
+    a ^= kSecret[1];
+    b ^= nSeed;
+    Multiply(a, b);
+
+    return Mix(a ^ kSecret[0] ^ nLength, b ^ kSecret[1]);
+}
+} // namespace
+
+uint64_t RZHash64(const void *pData, size_t nLength, uint64_t nSeed)
+{
+    return Hash<false>(pData, nLength, nSeed);
+}
+
+uint64_t RZCaseHash64(const void *pData, size_t nLength, uint64_t nSeed)
+{
+    return Hash<true>(pData, nLength, nSeed);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file
+ *
+ * @brief Fast non-cryptographic string hashing and hash container support for strings.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+#include "igzstring.h"
+#include "rzcasefold.h"
+#include "rzstring.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+
+/**
+ * @brief Hashes a block of memory with a wyhash style function.
+ *
+ * Results are stable for a given seed within a build but differ between little and big endian platforms, so they
+ * should not be written to files.
+ */
+uint64_t RZHash64(const void *pData, size_t nLength, uint64_t nSeed = 0);
+/**
+ * @brief Hashes a block of memory as RZHash64 would after folding ASCII letters to lower case.
+ */
+uint64_t RZCaseHash64(const void *pData, size_t nLength, uint64_t nSeed = 0);
+
+inline uint32_t RZHash32(const void *pData, size_t nLength, uint64_t nSeed = 0)
+{
+    uint64_t hash = RZHash64(pData, nLength, nSeed);
+    return uint32_t(hash ^ (hash >> 32));
+}
+
+inline uint32_t RZCaseHash32(const void *pData, size_t nLength, uint64_t nSeed = 0)
+{
+    uint64_t hash = RZCaseHash64(pData, nLength, nSeed);
+    return uint32_t(hash ^ (hash >> 32));
+}
+
+/**
+ * @brief Hash functor for any cIGZString, including cRZString.
+ */
+struct cRZStringHash
+{
+    size_t operator()(const cIGZString &szString) const { return size_t(RZHash64(szString.Data(), szString.Strlen())); }
+};
+
+/**
+ * @brief Hash functor that ignores ASCII case, pair with cRZStringCaseEqual.
+ */
+struct cRZStringCaseHash
+{
+    size_t operator()(const cIGZString &szString) const
+    {
+        return size_t(RZCaseHash64(szString.Data(), szString.Strlen()));
+    }
+};
+
+struct cRZStringCaseEqual
+{
+    bool operator()(const cIGZString &szLeft, const cIGZString &szRight) const
+    {
+        return RZCaseEqual(szLeft.Data(), szLeft.Strlen(), szRight.Data(), szRight.Strlen());
+    }
+};
+
+/**
+ * @brief Immutable string key that calculates its hash once on construction
+ *
+ * Useful for keys that are looked up repeatedly, the hash containers only ever read the stored value. The hash is
+ * case insensitive if the key was constructed that way, and so is comparing keys.
+ */
+class cRZHashedString
+{
+public:
+    cRZHashedString() : mnHash(RZHash64("", 0)), mbCaseSensitive(true) {}
+    cRZHashedString(const cIGZString &szString, bool bCaseSensitive = true) :
+        msString(szString),
+        mnHash(bCaseSensitive ? RZHash64(szString.Data(), szString.Strlen())
+                              : RZCaseHash64(szString.Data(), szString.Strlen())),
+        mbCaseSensitive(bCaseSensitive)
+    {
+    }
+
+    const cRZString &String() const { return msString; }
+    uint64_t Hash() const { return mnHash; }
+
+    bool operator==(const cRZHashedString &other) const
+    {
+        return mnHash == other.mnHash && msString.IsEqual(other.msString, mbCaseSensitive && other.mbCaseSensitive);
+    }
+
+    bool operator!=(const cRZHashedString &other) const { return !(*this == other); }
+
+private:
+    cRZString msString;
+    uint64_t mnHash;
+    bool mbCaseSensitive;
+};
+
+#ifndef MATCH_ABI
+namespace std
+{
+template<> struct hash<cRZString>
+{
+    size_t operator()(const cRZString &szString) const { return size_t(RZHash64(szString.data(), szString.size())); }
+};
+
+template<> struct hash<cRZHashedString>
+{
+    size_t operator()(const cRZHashedString &szString) const { return size_t(szString.Hash()); }
+};
+} // namespace std
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @file
+ *
+ * @brief Contention statistics for critical sections, recorded when built with LOCK_PROFILING.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzlockprofiler.h"
+
+#ifdef RZ_LOCK_PROFILING
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+// One record per name, shared by every critical section given that name and never freed so critical sections can
+// come and go without losing their history.
+struct RZLockProfile
+{
+    const char *mpName;
+    std::atomic<uint64_t> mnAcquireCount;
+    std::atomic<uint64_t> mnContendedCount;
+    std::atomic<uint64_t> mnWaitTime;
+    std::atomic<uint64_t> mnMaxHoldTime;
+    RZLockProfile *mpNext;
+};
+
+namespace
+{
+// Critical sections start out recording here so construction never has to touch the registry, which has its own lock.
+RZLockProfile gUnnamed = { "(unnamed)", { 0 }, { 0 }, { 0 }, { 0 }, nullptr };
+RZLockProfile *gpProfiles = &gUnnamed;
+std::atomic<uint64_t> gLastPeriodicDump(0);
+
+std::mutex &RegistryMutex()
+{
+    static std::mutex *mutex = new std::mutex;
+    return *mutex;
+}
+
+inline RZLockProfile *Resolve(RZLockProfile *pProfile)
+{
+    return pProfile != nullptr ? pProfile : &gUnnamed;
+}
+
+void PrintStats(const RZLockProfileStats &stats, void *context)
+{
+    fprintf(static_cast<FILE *>(context),
+        "%-32s %12llu %12llu %14.3f %12.3f\n",
+        stats.mpName,
+        static_cast<unsigned long long>(stats.mnAcquireCount),
+        static_cast<unsigned long long>(stats.mnContendedCount),
+        stats.mnWaitTime / 1000000.0,
+        stats.mnMaxHoldTime / 1000000.0);
+}
+} // namespace
+
+void RZLockProfileEnum(RZLockProfileCallback callback, void *context)
+{
+    std::vector<RZLockProfileStats> stats;
+
+    {
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+
+        for (RZLockProfile *profile = gpProfiles; profile != nullptr; profile = profile->mpNext) {
+            RZLockProfileStats entry = { profile->mpName,
+                profile->mnAcquireCount.load(std::memory_order_relaxed),
+                profile->mnContendedCount.load(std::memory_order_relaxed),
+                profile->mnWaitTime.load(std::memory_order_relaxed),
+                profile->mnMaxHoldTime.load(std::memory_order_relaxed) };
+            stats.push_back(entry);
+        }
+    }
+
+    // The callback runs without the registry lock so it can safely use critical sections itself.
+    for (const RZLockProfileStats &entry : stats) {
+        callback(entry, context);
+    }
+}
+
+void RZLockProfileDump(FILE *fp)
+{
+    std::vector<RZLockProfileStats> stats;
+    RZLockProfileEnum([](const RZLockProfileStats &entry, void *context) {
+        static_cast<std::vector<RZLockProfileStats> *>(context)->push_back(entry);
+    }, &stats);
+
+    std::sort(stats.begin(), stats.end(), [](const RZLockProfileStats &left, const RZLockProfileStats &right) {
+        return left.mnWaitTime > right.mnWaitTime;
+    });
+
+    fprintf(fp, "%-32s %12s %12s %14s %12s\n", "Lock", "Acquired", "Contended", "Wait (ms)", "Max hold (ms)");
+
+    for (const RZLockProfileStats &entry : stats) {
+        PrintStats(entry, fp);
+    }
+
+    fflush(fp);
+}
+
+bool RZLockProfilePeriodicDump(FILE *fp, uint32_t nInterval)
+{
+    uint64_t now = RZLockProfileNow();
+    uint64_t last = gLastPeriodicDump.load(std::memory_order_relaxed);
+
+    if (now - last < uint64_t(nInterval) * 1000000) {
+        return false;
+    }
+
+    // Only one caller wins the right to dump for each interval.
+    if (!gLastPeriodicDump.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    RZLockProfileDump(fp);
+
+    return true;
+}
+
+void RZLockProfileReset()
+{
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+
+    for (RZLockProfile *profile = gpProfiles; profile != nullptr; profile = profile->mpNext) {
+        profile->mnAcquireCount.store(0, std::memory_order_relaxed);
+        profile->mnContendedCount.store(0, std::memory_order_relaxed);
+        profile->mnWaitTime.store(0, std::memory_order_relaxed);
+        profile->mnMaxHoldTime.store(0, std::memory_order_relaxed);
+    }
+}
+
+RZLockProfile *RZLockProfileFind(const char *pszName)
+{
+    if (pszName == nullptr) {
+        return &gUnnamed;
+    }
+
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+
+    for (RZLockProfile *profile = gpProfiles; profile != nullptr; profile = profile->mpNext) {
+        if (std::strcmp(profile->mpName, pszName) == 0) {
+            return profile;
+        }
+    }
+
+    RZLockProfile *profile = new RZLockProfile;
+    profile->mpName = pszName;
+    profile->mnAcquireCount.store(0, std::memory_order_relaxed);
+    profile->mnContendedCount.store(0, std::memory_order_relaxed);
+    profile->mnWaitTime.store(0, std::memory_order_relaxed);
+    profile->mnMaxHoldTime.store(0, std::memory_order_relaxed);
+    profile->mpNext = gpProfiles;
+    gpProfiles = profile;
+
+    return profile;
+}
+
+uint64_t RZLockProfileNow()
+{
+    return uint64_t(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+void RZLockProfileAcquired(RZLockProfile *pProfile)
+{
+    Resolve(pProfile)->mnAcquireCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void RZLockProfileWaited(RZLockProfile *pProfile, uint64_t nWaitTime)
+{
+    RZLockProfile *profile = Resolve(pProfile);
+    profile->mnContendedCount.fetch_add(1, std::memory_order_relaxed);
+    profile->mnWaitTime.fetch_add(nWaitTime, std::memory_order_relaxed);
+}
+
+void RZLockProfileHeld(RZLockProfile *pProfile, uint64_t nHoldTime)
+{
+    std::atomic<uint64_t> &max_hold = Resolve(pProfile)->mnMaxHoldTime;
+    uint64_t current = max_hold.load(std::memory_order_relaxed);
+
+    while (nHoldTime > current && !max_hold.compare_exchange_weak(current, nHoldTime, std::memory_order_relaxed)) {
+    }
+}
+#else
+// Without LOCK_PROFILING nothing is recorded so there is never anything to report.
+void RZLockProfileEnum(RZLockProfileCallback, void *) {}
+
+void RZLockProfileDump(FILE *) {}
+
+bool RZLockProfilePeriodicDump(FILE *, uint32_t)
+{
+    return false;
+}
+
+void RZLockProfileReset() {}
+
+RZLockProfile *RZLockProfileFind(const char *)
+{
+    return nullptr;
+}
+
+uint64_t RZLockProfileNow()
+{
+    return 0;
+}
+
+void RZLockProfileAcquired(RZLockProfile *) {}
+
+void RZLockProfileWaited(RZLockProfile *, uint64_t) {}
+
+void RZLockProfileHeld(RZLockProfile *, uint64_t) {}
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @file
+ *
+ * @brief Contention statistics for critical sections, recorded when built with LOCK_PROFILING.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @brief Statistics for every critical section sharing a name, times are in nanoseconds.
+ */
+struct RZLockProfileStats
+{
+    const char *mpName;
+    uint64_t mnAcquireCount;
+    uint64_t mnContendedCount;
+    uint64_t mnWaitTime;
+    uint64_t mnMaxHoldTime;
+};
+
+struct RZLockProfile;
+
+typedef void (*RZLockProfileCallback)(const RZLockProfileStats &stats, void *context);
+
+/**
+ * @brief Calls a function with the statistics for each name critical sections have been given, plus unnamed ones.
+ * Does nothing unless built with LOCK_PROFILING.
+ * @param callback Function to call.
+ * @param context Pointer passed through to the callback.
+ */
+void RZLockProfileEnum(RZLockProfileCallback callback, void *context);
+/**
+ * @brief Writes a table of the statistics to a file, most time spent waiting first.
+ * @param fp File to write to.
+ */
+void RZLockProfileDump(FILE *fp);
+/**
+ * @brief Writes a table of the statistics to a file if the interval has passed since it last did, for calling from a
+ * tick.
+ * @param fp File to write to.
+ * @param nInterval Milliseconds to leave between dumps.
+ * @return If the statistics were written.
+ */
+bool RZLockProfilePeriodicDump(FILE *fp, uint32_t nInterval);
+/**
+ * @brief Zeroes all statistics.
+ */
+void RZLockProfileReset();
+
+// Used by cRZCriticalSection to record statistics.
+RZLockProfile *RZLockProfileFind(const char *pszName);
+uint64_t RZLockProfileNow();
+void RZLockProfileAcquired(RZLockProfile *pProfile);
+void RZLockProfileWaited(RZLockProfile *pProfile, uint64_t nWaitTime);
+void RZLockProfileHeld(RZLockProfile *pProfile, uint64_t nHoldTime);
@@ -13,6 +13,29 @@
 #include "rzrandom.h"
 #include <ctime>
 
+namespace
+{
+// Composes the affine step x * mul + add with itself steps times by repeated squaring, all modulo 2^32.
+uint32_t AffineJump(uint32_t value, uint32_t mul, uint32_t add, uint32_t steps)
+{
+    uint32_t total_mul = 1;
+    uint32_t total_add = 0;
+
+    while (steps != 0) {
+        if (steps & 1) {
+            total_mul *= mul;
+            total_add = total_add * mul + add;
+        }
+
+        add *= mul + 1;
+        mul *= mul;
+        steps >>= 1;
+    }
+
+    return value * total_mul + total_add;
+}
+} // namespace
+
 cRZRandom::cRZRandom(uint32_t seed)
 {
     Seed(seed);
@@ -47,6 +70,24 @@ uint32_t cRZRandom::RandomUint32Uniform(uint32_t scale)
     return (scale * uint64_t(RandomUint32Uniform())) >> 32;
 }
 
+uint32_t cRZRandom::RandomUint32Bounded(uint32_t range)
+{
+    // Same nearly divisionless rejection as cRZRandomSuper::RandomUint32Bounded.
+    uint64_t m = uint64_t(RandomUint32Uniform()) * range;
+    uint32_t low = uint32_t(m);
+
+    if (low < range) {
+        uint32_t threshold = (0 - range) % range;
+
+        while (low < threshold) {
+            m = uint64_t(RandomUint32Uniform()) * range;
+            low = uint32_t(m);
+        }
+    }
+
+    return uint32_t(m >> 32);
+}
+
 int32_t cRZRandom::RandomSint32RangeUniform(int32_t min, int32_t max)
 {
     return min + RandomUint32Uniform(max - min);
@@ -63,7 +104,29 @@ double cRZRandom::RandomDoubleUniform()
     return (mnRealSeed * 2.328306436538696e-10) + 0.5;
 }
 
+double cRZRandom::RandomDouble53()
+{
+    uint32_t a = RandomUint32Uniform() >> 5;
+    uint32_t b = RandomUint32Uniform() >> 6;
+
+    return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+}
+
 double cRZRandom::RandomDoubleRangeUniform(double min, double max)
 {
     return (RandomDoubleUniform() * (max - min)) + min;
 }
+
+void cRZRandom::Jump(uint32_t steps)
+{
+    mnIntegerSeed = AffineJump(mnIntegerSeed, 1103515245, 12345, steps);
+    mnRealSeed = int32_t(AffineJump(uint32_t(mnRealSeed), 663608941, 0, steps));
+}
+
+cRZRandom cRZRandom::Split()
+{
+    cRZRandom split(*this);
+    Jump(SPLIT_STRIDE);
+
+    return split;
+}
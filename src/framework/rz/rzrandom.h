@@ -16,6 +16,12 @@
 
 class cRZRandom
 {
+public:
+    enum
+    {
+        SPLIT_STRIDE = 0x1000000, // Values handed to each generator returned from Split.
+    };
+
 public:
     cRZRandom(uint32_t seed = UINT32_MAX);
 
@@ -35,6 +41,13 @@ public:
      * @return Random value.
      */
     uint32_t RandomUint32Uniform(uint32_t scale);
+    /**
+     * @brief Generates a random 32bit unsigned integer without the bias RandomUint32Uniform(scale) has, occasionally
+     * drawing more than one value from the generator.
+     * @param range Value returned will be smaller than this unless it is 0.
+     * @return Random value.
+     */
+    uint32_t RandomUint32Bounded(uint32_t range);
     /**
      * @brief Generates a random 32bit unsigned integer within a range.
      * @param min Value returned should be no smaller than this.
@@ -47,6 +60,12 @@ public:
      * @return Random value.
      */
     double RandomDoubleUniform();
+    /**
+     * @brief Generates a random 64bit floating point value using the full 53bit mantissa, drawing two values from the
+     * integer sequence rather than the one RandomDoubleUniform uses.
+     * @return Random value in the range [0, 1).
+     */
+    double RandomDouble53();
     /**
      * @brief Generates a random 64bit floating point value.
      * @param min Value returned should be no smaller than this.
@@ -54,6 +73,18 @@ public:
      * @return Random value.
      */
     double RandomDoubleRangeUniform(double min, double max);
+    /**
+     * @brief Advances the generator as if RandomUint32Uniform and RandomDoubleUniform had each been called a number of
+     * times, taking time proportional to the log of the distance.
+     * @param steps Number of values to skip in each sequence.
+     */
+    void Jump(uint32_t steps);
+    /**
+     * @brief Splits off a generator for another worker that won't overlap with this one for SPLIT_STRIDE values.
+     * @return Generator producing the next SPLIT_STRIDE values this generator would have, this generator then
+     * continues after them.
+     */
+    cRZRandom Split();
 
 private:
     uint32_t mnIntegerSeed;
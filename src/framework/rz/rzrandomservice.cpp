@@ -0,0 +1,202 @@
+/**
+ * @file
+ *
+ * @brief Random number service giving each thread its own generator derived from a master seed.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzrandomservice.h"
+#include "rzcriticalsection.h"
+#include "rzthreadsafe.h"
+#include <new>
+#include <type_traits>
+
+namespace
+{
+// Scaling keeps a generated seed below UINT32_MAX, which would otherwise mean generate another one.
+uint32_t PickSeed(uint32_t seed)
+{
+    return seed != UINT32_MAX ? seed : cRZRandomSuper(UINT32_MAX).RandomUint32Uniform(UINT32_MAX);
+}
+
+// Only hands out stream indices, the jumps to reach them are done by each thread outside the lock.
+struct RandomMaster
+{
+    RandomMaster() : mnSeed(PickSeed(UINT32_MAX)), mnStreams(0) {}
+
+    cRZCriticalSection mLock;
+    uint32_t mnSeed;
+    uint32_t mnStreams;
+};
+
+// The engine is only constructed when a thread first draws so threads that never draw don't pay for seeding it.
+struct ThreadRandom
+{
+    ThreadRandom() : mnGeneration(0) {}
+
+    cRZRandomSuper &Engine() { return *reinterpret_cast<cRZRandomSuper *>(mEngine); }
+
+    alignas(cRZRandomSuper) unsigned char mEngine[sizeof(cRZRandomSuper)];
+    uint32_t mnGeneration;
+};
+
+// Nothing runs the engine's destructor when a thread exits.
+static_assert(std::is_trivially_destructible<cRZRandomSuper>::value, "cRZRandomSuper must be trivially destructible");
+
+// Bumped each time the master is reseeded so threads know to split off a new generator, starts at 1 so a thread's
+// generator is split on first use.
+cRZAtomic<uint32_t> gGeneration(1);
+
+inline uint32_t LoadGeneration()
+{
+    return gGeneration.Load(kRZMemoryOrderAcquire);
+}
+
+inline void BumpGeneration()
+{
+    gGeneration.FetchAdd(1, kRZMemoryOrderRelease);
+}
+
+thread_local ThreadRandom tRandom;
+
+// Deliberately never destroyed, threads may still draw during static destruction.
+RandomMaster &Master()
+{
+    static RandomMaster *master = new RandomMaster;
+    return *master;
+}
+} // namespace
+
+cRZRandomSuper &RZThreadRandom()
+{
+    ThreadRandom &random = tRandom;
+
+    if (random.mnGeneration != LoadGeneration()) {
+        RandomMaster &master = Master();
+        uint32_t seed;
+        uint32_t stream;
+        uint32_t generation;
+
+        {
+            cRZLock lock(master.mLock);
+            seed = master.mnSeed;
+            stream = master.mnStreams++;
+            generation = LoadGeneration();
+        }
+
+        if (random.mnGeneration == 0) {
+            new (random.mEngine) cRZRandomSuper(seed);
+        } else {
+            random.Engine().Seed(seed);
+        }
+
+        random.Engine().Jump(stream);
+        random.mnGeneration = generation;
+    }
+
+    return random.Engine();
+}
+
+void RZSetMasterRandomSeed(uint32_t seed)
+{
+    RandomMaster &master = Master();
+    cRZLock lock(master.mLock);
+    master.mnSeed = PickSeed(seed);
+    master.mnStreams = 0;
+    BumpGeneration();
+}
+
+uint32_t RZGetMasterRandomSeed()
+{
+    RandomMaster &master = Master();
+    cRZLock lock(master.mLock);
+
+    return master.mnSeed;
+}
+
+cRZRandomService::cRZRandomService() :
+    mnRefCount(0),
+    mnServiceID(kRZSRVID_cRZRandomService),
+    mnServicePriority(0),
+    mbServiceRunning(false)
+{
+}
+
+bool cRZRandomService::QueryInterface(uint32_t iid, void **obj)
+{
+    switch (iid) {
+        case GZIID_cIGZUnknown:
+            *obj = static_cast<cIGZUnknown *>(this);
+            AddRef();
+            return true;
+        case GZIID_cIGZSystemService:
+            *obj = static_cast<cIGZSystemService *>(this);
+            AddRef();
+            return true;
+        case GZIID_cIGZRandomService:
+            *obj = static_cast<cIGZRandomService *>(this);
+            AddRef();
+            return true;
+        default:
+            break;
+    }
+
+    return false;
+}
+
+uint32_t cRZRandomService::AddRef()
+{
+    return mnRefCount.AddRef();
+}
+
+uint32_t cRZRandomService::Release()
+{
+    uint32_t count = mnRefCount.ReleaseSigned();
+
+    if (count == 0) {
+        delete this;
+        return 0;
+    }
+
+    return count;
+}
+
+void cRZRandomService::SetMasterSeed(uint32_t seed)
+{
+    RZSetMasterRandomSeed(seed);
+}
+
+uint32_t cRZRandomService::GetMasterSeed() const
+{
+    return RZGetMasterRandomSeed();
+}
+
+uint32_t cRZRandomService::RandomUint32Uniform()
+{
+    return RZThreadRandom().RandomUint32Uniform();
+}
+
+uint32_t cRZRandomService::RandomUint32Uniform(uint32_t scale)
+{
+    return RZThreadRandom().RandomUint32Uniform(scale);
+}
+
+int32_t cRZRandomService::RandomSint32RangeUniform(int32_t min, int32_t max)
+{
+    return RZThreadRandom().RandomSint32RangeUniform(min, max);
+}
+
+double cRZRandomService::RandomDoubleUniform()
+{
+    return RZThreadRandom().RandomDoubleUniform();
+}
+
+double cRZRandomService::RandomDoubleRangeUniform(double min, double max)
+{
+    return RZThreadRandom().RandomDoubleRangeUniform(min, max);
+}
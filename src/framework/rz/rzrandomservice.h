@@ -0,0 +1,99 @@
+/**
+ * @file
+ *
+ * @brief Random number service giving each thread its own generator derived from a master seed.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+
+#include "igzrandomservice.h"
+#include "rzrandomsuper.h"
+#include "rzrefcount.h"
+
+static constexpr uint32_t kRZSRVID_cRZRandomService = 0x8A3E15C3;
+
+/**
+ * @brief Retrieves the calling thread's generator without taking any locks.
+ *
+ * Each thread's generator is seeded from the master seed and jumped once for every thread that drew before it, the
+ * first time the thread draws and again after the master seed changes. Threads get streams that won't overlap for
+ * TWIST_SIZE * 2^64 values and that depend only on the master seed and the order threads first draw in, and the jumps
+ * happen outside any lock so threads starting together don't wait on each other.
+ * @return Generator owned by the calling thread.
+ */
+cRZRandomSuper &RZThreadRandom();
+/**
+ * @brief Sets the seed every thread's generator is derived from.
+ * @param seed Value to use to seed the generators, UINT32_MAX picks a seed from the current time.
+ */
+void RZSetMasterRandomSeed(uint32_t seed);
+/**
+ * @return The seed every thread's generator is currently derived from.
+ */
+uint32_t RZGetMasterRandomSeed();
+
+/**
+ * @brief Handle to the calling thread's generator, holds no state so it can be embedded anywhere for free.
+ */
+class cRZRandomHandle
+{
+public:
+    cRZRandomSuper *operator->() const { return &RZThreadRandom(); }
+    cRZRandomSuper &operator*() const { return RZThreadRandom(); }
+};
+
+class cRZRandomService : public cIGZRandomService
+{
+public:
+    cRZRandomService();
+    virtual ~cRZRandomService() {}
+
+    /**
+     * @brief Casts the object to the interface specified by riid
+     * @param riid The GUID for the interface type to cast to
+     * @param ppvObj A pointer to a void pointer to store the result in
+     * @return Whether the object could be successfully cast or not
+     */
+    virtual bool QueryInterface(uint32_t iid, void **obj) override;
+    /**
+     * @brief Adds a reference to this object
+     * @return The new reference count for this object
+     */
+    virtual uint32_t AddRef() override;
+    /**
+     * @brief Removes a reference to this object
+     * @return The new reference count for this object
+     */
+    virtual uint32_t Release() override;
+
+    virtual uint32_t GetServiceID() const override { return mnServiceID; }
+    virtual void SetServiceID(uint32_t sid) override { mnServiceID = sid; }
+    virtual int32_t GetServicePriority() const override { return mnServicePriority; }
+    virtual bool IsServiceRunning() const override { return mbServiceRunning; }
+    virtual void SetServiceRunning(bool running) override { mbServiceRunning = running; }
+    virtual bool Init() override { return true; }
+    virtual bool Shutdown() override { return true; }
+    virtual bool OnTick() override { return true; }
+    virtual bool OnIdle() override { return true; }
+    virtual int32_t GetServiceTickPriority() const override { return mnServicePriority; }
+
+    virtual void SetMasterSeed(uint32_t seed) override;
+    virtual uint32_t GetMasterSeed() const override;
+    virtual uint32_t RandomUint32Uniform() override;
+    virtual uint32_t RandomUint32Uniform(uint32_t scale) override;
+    virtual int32_t RandomSint32RangeUniform(int32_t min, int32_t max) override;
+    virtual double RandomDoubleUniform() override;
+    virtual double RandomDoubleRangeUniform(double min, double max) override;
+
+private:
+    cRZRefCountMT mnRefCount;
+    uint32_t mnServiceID;
+    int32_t mnServicePriority;
+    bool mbServiceRunning;
+};
@@ -11,13 +11,617 @@
  *            LICENSE
  */
 #include "rzrandomsuper.h"
+#include "rzthreadsafe.h"
+#include <cpufeatures.h>
+#include <cmath>
+#include <cstring>
 #include <ctime>
 
+// The last word of the reload doesn't follow the standard MT19937 recurrence so the polynomial can't be taken from the
+// reference jump tables. It is the least common multiple of the Berlekamp-Massey polynomials of several state bits and
+// random combinations of them, checked to reduce random states to zero. It is x^34 times a square free polynomial with
+// factors of degree 7, 7, 11 and 40 and the remaining 19837 degrees in factors larger than 64, so the period is far
+// beyond anything a jump can reach.
+const uint32_t kRZReloadPolynomial[] = {
+    0x00000000, 0x184d089c, 0x89b28700, 0x5444a671, 0x4a63a225, 0x3ba62c39, 0xd96e92dd, 0x300d2c19,
+    0xf58afde3, 0x3e40b255, 0x45710b7f, 0xea935971, 0x35fb2452, 0x4c6f64b6, 0x740931fb, 0x6f0ae2aa,
+    0xef4905b1, 0x2a2249c8, 0x2501a932, 0x79d1a6cf, 0xcd06cf70, 0x65884742, 0xc2e776de, 0xb2aa3d08,
+    0x1e899190, 0x172d0964, 0xc3f55045, 0xc9af5ad3, 0x8c19e800, 0x18f76096, 0x87b77f7f, 0xe86ce51d,
+    0x885a9b84, 0x596b592f, 0x1a4ec8e3, 0x210adf45, 0x74ecf348, 0x63e395af, 0xd75822cb, 0x3886bd27,
+    0x8d8074c7, 0x05562813, 0x73a209a6, 0xefa17f57, 0xa0aad8a6, 0x18efcb61, 0xe68a0031, 0xb9c4ca4c,
+    0x05e069a6, 0x071e48f1, 0x7aeb0b72, 0xb93cedb0, 0x26be75a6, 0x3aefdb5d, 0x44286956, 0x714f6db1,
+    0xf0e345e5, 0xfa8c26eb, 0x480b7a22, 0xd0a1bc63, 0x61dc1228, 0xe4e3f91f, 0xca4ec0d4, 0x3de57953,
+    0x1477205f, 0x57539dfd, 0xe929b469, 0xd41309b7, 0xdd641800, 0xec422de0, 0xb936f2aa, 0x35118875,
+    0xa7abe7b3, 0x302896e0, 0x92ad47f7, 0xf5eed29c, 0xd4a04cc5, 0x9f4c83b8, 0x346c0e04, 0x7ec9418b,
+    0xb13cb98c, 0xb4fdd152, 0xe0a7ee18, 0x65981bf1, 0x0109a059, 0x4fcf4b69, 0x353f4a01, 0x86caf8c2,
+    0x341d0635, 0xfbb86a18, 0x5ad28ea7, 0xfc8c862e, 0xb8ec6384, 0x7f305597, 0xe9e671f1, 0x4cc9512c,
+    0x12d20992, 0xf731f2bf, 0x5375c3f8, 0x6f985c6e, 0xd69cf582, 0x6aa81c1f, 0xd144dd80, 0xddbc1766,
+    0x845d72bd, 0x637acbe8, 0x868cf883, 0x333719d7, 0x67e327b9, 0xa6295904, 0x39d7de1d, 0x8408d20d,
+    0xf1cd9120, 0x26f02fdc, 0x633a138f, 0xb1494f4e, 0xe3c65e65, 0xb0f6cc8e, 0x685e4404, 0x3b8684d6,
+    0xae6345b5, 0x0d7666ae, 0xaa383399, 0xbb71e415, 0x09b7666d, 0xd6e28418, 0xc4f6d570, 0x4725afee,
+    0x401ad45a, 0x365324d4, 0x69785d20, 0x66eb653b, 0xa7cb0893, 0x4fa5cbed, 0x5e2f0309, 0x93779398,
+    0x11746f89, 0xdbf88343, 0xc8945763, 0x5d6a0909, 0x198fa972, 0xc1e3de70, 0x71eb218d, 0xdb5c49a4,
+    0x03b1e7f5, 0xc5469bf8, 0xff4b3f27, 0x1824415e, 0x8fec3b53, 0x018d800c, 0x1e569c4e, 0xbe411ac6,
+    0x2f3aa2fa, 0x8e81f99c, 0x2f8a4a46, 0x250572db, 0xed49b590, 0xc8e61931, 0x67799bdd, 0x97445e7e,
+    0x65d7b093, 0xd174f409, 0xa40f2d26, 0x7ad731dc, 0x417b33d4, 0xf6c3c7cf, 0xdaf0ac08, 0x09f94aee,
+    0x12a59a67, 0x0a75591e, 0x3cb990f0, 0x50d8063b, 0xb4d4e16a, 0xed0945a0, 0x54c1f89d, 0x31f7899d,
+    0xa83f4b2b, 0xd44b05c8, 0xb518210f, 0x3202feab, 0x06899bc9, 0x1a1a1b2b, 0xaa1abd35, 0xfb1acfc9,
+    0xf2374761, 0xf46bb919, 0x18266239, 0xe2f57096, 0xb065048b, 0x2e79cf5a, 0x635f0828, 0xb7aabea8,
+    0x5e7a138d, 0x347d1a15, 0xb0060683, 0xfbf2b7fe, 0xee43979d, 0xe937da49, 0xc3679073, 0x40d6a25e,
+    0x76a5a02e, 0x3f7c3cea, 0x71dc4f2e, 0x04d1b692, 0x129b7913, 0x2c32ad10, 0xaf4d9448, 0xbea0fe8f,
+    0x025d0a0b, 0xf7289b15, 0xbad1b9df, 0xe3fed2b4, 0xdfb5d7ea, 0x530cb0b5, 0x65600868, 0x57724eb5,
+    0x91c04bce, 0x6e7cfa8f, 0xda3f1922, 0x904442ea, 0x2d173663, 0x34c582ed, 0x0fbda776, 0xce9e41ea,
+    0x4a14e42c, 0x10804a10, 0xe1284a33, 0xc6beb8f5, 0x1dce491e, 0xf212e2d7, 0xfe82e2b0, 0xe7219fff,
+    0xacaeed0e, 0x270797a9, 0x9c7d21d5, 0x5fb09961, 0x5102624a, 0xa8a750a1, 0xac1c60df, 0xa6803017,
+    0x20e6ee01, 0xfecf0970, 0xd9ac2162, 0x7f8d71e6, 0x3994aed3, 0x0ab67f46, 0x55c20758, 0x800c7f50,
+    0x5afd37d5, 0x89053b2e, 0xfd056102, 0x2e834b75, 0x7534b46d, 0x7b329c64, 0x99da3d55, 0x159423fc,
+    0xc5f46fcc, 0xaf428f4c, 0x64169c31, 0xe92496f9, 0xad2ffb1a, 0x1ad4ea8f, 0x2244addf, 0x4ecf4713,
+    0x27789991, 0x08d8836e, 0xa9a95e16, 0x05fea1a7, 0xc7d04c3d, 0xd7a90a88, 0xeef5b221, 0xbc889fd9,
+    0x2b0c7c86, 0x94639f59, 0x0a612c90, 0xd8b2338c, 0x52a72f8c, 0x54303134, 0xb6b5f179, 0x97d34c6c,
+    0x18e03592, 0xc06b3c91, 0x700ec70b, 0x6fcb1ddf, 0x10c93533, 0x2fd56751, 0xa65c9a1b, 0x81d96f82,
+    0x01a431e6, 0x9ffa3015, 0x1f2db5cd, 0xfac59d09, 0x3677f2f1, 0x7f10d750, 0xd3b7397f, 0x33b2b7c9,
+    0x31fd8d3f, 0xd0063b57, 0xfbeed0e7, 0x29116b08, 0x32d26a4a, 0x67ddba56, 0x553a901d, 0xe055d4c3,
+    0x2a498564, 0x1555505b, 0x04bfa74e, 0x4060fa7f, 0x38f8b2ad, 0xc46906da, 0xeb29e5e1, 0x69591b41,
+    0x659cae25, 0xf576a322, 0x30d40770, 0xb273e567, 0x015a2bc8, 0x1b00aede, 0xb14e15d9, 0x76ba6b20,
+    0x26cb2d23, 0x9e91ca91, 0xfa7dad02, 0x9e371ce7, 0x9b8dcf20, 0x4d620652, 0xec6dfe11, 0xb06a0ed4,
+    0x81d655c9, 0xceca3516, 0x28e7ae07, 0xb8d578d7, 0x27e91909, 0x40cd4ae4, 0x881294d4, 0xbd31b3f0,
+    0x968ee034, 0x26d92d60, 0x7cb1d7fc, 0xc98c7f17, 0xdda20081, 0xd7fbe260, 0x413c8f6d, 0xa19d7c7b,
+    0xcc5f0b81, 0x7ff59a3a, 0x1e514c12, 0xe606eac2, 0x21e1889d, 0x6d9bb583, 0x7c029a3c, 0xcdef010a,
+    0xae5d074c, 0x76d9d6e8, 0xc16e85ce, 0xf9863f83, 0x92e83c34, 0x817a464f, 0xea31e26d, 0xec000c61,
+    0x2b62308b, 0xc0ae14e8, 0xb68d74c9, 0x0d025fcf, 0x715c8197, 0xa96e31f0, 0x1fbd4d04, 0xb225f8cf,
+    0xd9d68709, 0xbb6e9489, 0xf010ba85, 0x823eff1b, 0x8b0988ed, 0x545ab017, 0x848caacc, 0xd98b6238,
+    0x2616371a, 0x9aab82ea, 0xf588b947, 0x4134d625, 0x75a39f0a, 0xee232d24, 0x50dbf165, 0xa836d7f7,
+    0x81648e93, 0x40c4b7a2, 0x86c479ad, 0x9d3161aa, 0xde89ab44, 0x43bf3040, 0x3ace2ba1, 0xcc76d7ce,
+    0x076cf8c7, 0x4fd8a791, 0xe8594504, 0x386ebeb9, 0xde17358b, 0x3d8058b3, 0xd049f48a, 0xb69f600b,
+    0x6ada0cf2, 0xb325307f, 0x70de0208, 0x978ab685, 0x21040548, 0x3ca008b2, 0x85b426d5, 0x49006098,
+    0xa827aa3e, 0x4ba6aace, 0xa5c7f270, 0x5f48278a, 0x75bdc600, 0xd45ad825, 0xcfe61c40, 0x29b9398b,
+    0x404d53bf, 0xb1c5411d, 0x304be7cc, 0x118f4143, 0x83fdb630, 0xe45afd86, 0x8214e3fa, 0xb1fccce0,
+    0x54ef7b9d, 0x187966e1, 0xbb4db8a4, 0x7b31c09a, 0xded12a59, 0xcb01a28c, 0x3783d7ae, 0x47dac2a4,
+    0xdbfb2791, 0x132f87f8, 0xd8f2e7a9, 0xfc08adbc, 0x677d1b59, 0x295b5b0e, 0x485501e6, 0xd009c10d,
+    0x8d0ce055, 0x81363f73, 0xc7bfa6d9, 0xd2a209ee, 0x2cc241ec, 0xa6507f69, 0x1e1006e5, 0x8d98a4f7,
+    0x9b8514f7, 0x50d8920d, 0xc4d52a49, 0xf19a00c4, 0x18febac4, 0xa8c1c79a, 0x15a66a65, 0x27a0ae7a,
+    0xbc097473, 0xd05b3821, 0xe1c42b8e, 0xc28c0447, 0x9398e7db, 0x122c08a9, 0xb24dc252, 0x4e6a24b8,
+    0xfa492e46, 0x9a95af3e, 0x27ced91a, 0x71311e80, 0xf5f2558d, 0x7d8b3aab, 0xc11529b2, 0xc70cd9c3,
+    0xce1328d0, 0x293ac17e, 0xd2a6830f, 0xc5454f40, 0x1c72d8a1, 0xc73400e7, 0xd10f3481, 0xce87b72f,
+    0xd41e08e9, 0x0a6b5988, 0xdd5f1011, 0x103310db, 0xea914bd7, 0xddfc39ff, 0x8d9974d5, 0xf4d72f84,
+    0xd69a2ec4, 0x3c6a2bbd, 0x416bee2a, 0x6ba077ff, 0x32c0f38b, 0x0acae051, 0xb298f9d9, 0xb3c1f375,
+    0xd51e916b, 0xbf9f4ced, 0xc0dc457e, 0x63fdaf39, 0xb652521c, 0x5ae8cd14, 0x79bb0c6f, 0x7a1cb4a6,
+    0xf58e4336, 0x820353cb, 0x86d451a0, 0xc0ea20dd, 0xd5760a5f, 0x82c6500f, 0x985fa7be, 0xd91a76cf,
+    0xc5f49a16, 0xa0ab730a, 0xf71d26e8, 0xbf570c47, 0xa97605f5, 0x0b39357d, 0x7e674575, 0xb11bd68d,
+    0x6005d60a, 0xcb598f86, 0xd5bb3ea1, 0x7b601fa8, 0xc54a20e5, 0x3cf0750f, 0x4191e72e, 0x38ddb0f1,
+    0xcf396b2e, 0x56d6b7e7, 0x0ed48f8b, 0x976859d7, 0xe964850f, 0x13c3b8e8, 0xa8b62c6d, 0xb4838768,
+    0x30c3464d, 0x10dcc546, 0xae293d32, 0xba592d1b, 0xfe92bc19, 0xb6ecb324, 0xc4b9e7fd, 0x812fd1b6,
+    0xb69d0806, 0x3e0f0f97, 0x740a05ad, 0x17fec105, 0x77fdf68b, 0x492843fd, 0xb8cf9f2d, 0x59f9376a,
+    0xe5e355dd, 0xc06ac65b, 0x95ebf5f3, 0x9281ebe4, 0x8ea4b7e3, 0x03d157d0, 0x7488eb07, 0xd5b8aea6,
+    0x5c670dd3, 0x73ac3762, 0x03c86f55, 0x2b69f974, 0x7f5cfb34, 0x212e273b, 0x38979d9e, 0x43cbf9ea,
+    0x1f66bec9, 0xf4f264fc, 0x529d741b, 0x89e2ed75, 0xf17548ee, 0x425f46ee, 0xc775cec3, 0x376827f1,
+    0xbea3083f, 0x9e780792, 0xd0301497, 0xecdf0003, 0xeb2aace3, 0xceaa5312, 0x5c2d2e56, 0xcf402211,
+    0x41b2bf4d, 0x9d5bffcd, 0x1a5b474a, 0xdb8256ec, 0xbb3553ca, 0x218b6558, 0x6042a902, 0x9a1bb884,
+    0xbc1f0e26, 0x02402afc, 0xaf253e2a, 0x49c9f6fc, 0x905fb90f, 0x67289203, 0x66507ba0, 0xe3eefece,
+    0xcc91ab45, 0x8c928bcb, 0x295d57db, 0x7d384299, 0xcc167001, 0xd1d8bc91, 0xec9c9cd6, 0xafe70063,
+    0x254a7c6f, 0x6a4fe2bb, 0xb482ed95, 0x3528b90a, 0x09164048, 0xb8484283, 0xc0100318, 0x2b801c0e,
+    0x13180800, 0x000e4050, 0x08000000, 0x00001000, 0x00010000, 0x00000040, 0x00000000, 0x00000001
+};
+
+namespace
+{
+// Values are converted through a small stack buffer by the Fill variants that don't produce raw integers.
+const size_t kFillBlock = 256;
+
+// Coefficients of x^(2^64) modulo kRZReloadPolynomial, lowest degree first.
+const uint32_t kJumpPolynomial[] = {
+    0x00000000, 0x46b561f4, 0xc1368973, 0x95ba942a, 0x54f98e10, 0x7a3ca159, 0xddb9c263, 0x4ede284a,
+    0x3eae6aa3, 0xf5a0bbd1, 0xe5d4d2a5, 0xaabfd0ee, 0xace0f577, 0x4b466d15, 0x36c7b380, 0xd6cb1fdb,
+    0x07f4ab47, 0x700f7829, 0xc043d7cc, 0x1e919d4a, 0x1851f89f, 0x6c68e9bb, 0xd896efc4, 0x7b705885,
+    0x924e9c68, 0x06123474, 0x594b2d1d, 0x99e2ff11, 0xe0e92404, 0x51550e62, 0x583e09ab, 0x61fa92c5,
+    0xcb3df351, 0xda680ff5, 0x2d5a8b91, 0x0fa85239, 0xd786642a, 0x6e5d9dd7, 0x2f6aaf29, 0xd8aeaee2,
+    0x77e004b2, 0x5ae7f1c0, 0x8ffe1824, 0x1e02dbb9, 0xe13d43c6, 0xccd93465, 0xe70fd4e3, 0x151c202d,
+    0xabe8938b, 0x27655d03, 0xa09507bc, 0x1023de4b, 0xd976e552, 0x1637b888, 0x215876cc, 0x8b57ef61,
+    0x26ca56a0, 0x492f816c, 0xea56e81b, 0x4551f271, 0x6e94a6b2, 0x114c3a6d, 0x66b9849d, 0x796eec31,
+    0x9577d1e3, 0x3dac2e33, 0x085cae4a, 0x638f9a26, 0x793904dc, 0xed57099b, 0x0f9f8dc7, 0x95581c6e,
+    0x3496e3bb, 0x2d4eced0, 0xcda0305e, 0x662837ea, 0xb64798d9, 0x3195e299, 0x5a6f8c9a, 0x277664fa,
+    0xe04e044d, 0xb740d98a, 0x08e573e9, 0x3330e4f6, 0xbc1f9843, 0x598fee00, 0xa5f93f1c, 0xc5c15c6b,
+    0x2fc971d6, 0x3225b24f, 0xdc896c6c, 0xbcf68e65, 0xb977cb6c, 0x79029dd7, 0xcf39074f, 0xe4d88628,
+    0x62814fcb, 0x4f3db537, 0x1e523d52, 0x9cb12467, 0x4300ed29, 0x721f9622, 0x1095861d, 0x12b64c1a,
+    0x67cc1a51, 0x565e62ad, 0x6c39c509, 0x1336d1b2, 0x284aba5e, 0xcb82cb95, 0x9a09d6bd, 0x514ddd07,
+    0xab8d99a0, 0x6fb79822, 0xb1d12b0a, 0x387c1690, 0x11a5a0ac, 0xb110e97e, 0x6b41eefb, 0x4a77bc0f,
+    0xb985092e, 0x54e27fd4, 0x88085210, 0xad2e35b3, 0x8091bb20, 0xdd6ae214, 0xc17cb07b, 0xf7b1694e,
+    0xc068d02b, 0x11de8bd9, 0x3098d4a9, 0xacda584b, 0x6d0a8afa, 0x80f41a14, 0xf827e713, 0xfb7191af,
+    0xeeeb3bf9, 0x25bf86f2, 0xea3d4236, 0x55cf01eb, 0xaf8f469a, 0xea13f6f8, 0x9f57237c, 0x1a7264e9,
+    0x67e323df, 0xbf5a3073, 0xf465fe79, 0x40cfe40c, 0x4fad4f89, 0x48057501, 0x3f7189cf, 0x8fbdd14a,
+    0x925c3598, 0x752d58d3, 0x1a3efebc, 0x49dd40e9, 0x8f99bb7f, 0x75b85b4a, 0x3887b224, 0xd44420a8,
+    0x614bec13, 0xd8828884, 0x45774186, 0x1c7916fc, 0x12c78e88, 0x88dd7453, 0xba0d0c82, 0x9b96de91,
+    0x0916e68d, 0x1f544c2e, 0xf054da43, 0xb05e4d2c, 0x5ce97217, 0x04dc66de, 0x8f244c7c, 0xf5259108,
+    0x6625c4aa, 0xa9841d52, 0x0ce92129, 0x7f9ed08d, 0xffe80c15, 0x97e78894, 0x16e891e9, 0x023a1793,
+    0x1447b102, 0x0c3d0b0f, 0xf39de083, 0xb01046c4, 0x285f16db, 0xb65d8486, 0x44204fa1, 0x5eda5657,
+    0x7d21447e, 0xe2914109, 0x5e5834f7, 0x7e3023cf, 0x087d1cdb, 0x82939241, 0x13b6758a, 0xf80aade7,
+    0x8c514474, 0x3ae45848, 0x3c18cd1e, 0x94a8d3f0, 0x628aa6ee, 0x1c426e1b, 0x925e299c, 0x08f3f7e6,
+    0xac03f039, 0xa144500b, 0x2614f671, 0x961c8a41, 0xbe043f32, 0xea4ce194, 0x91d90215, 0xf62f450e,
+    0xf0979e31, 0x2a3177cc, 0x570b7ff9, 0x2bc4b439, 0x095317a2, 0xd9fb9e85, 0x4cbc3668, 0xf0548f4b,
+    0xd3e916c3, 0xb69971e6, 0x6df18f15, 0x49db440b, 0x72bfc1e9, 0xf5581412, 0xc2a4acbe, 0xc9ca7fc0,
+    0x26df7ae2, 0x6b7dc6f0, 0x1570df08, 0xe6feb8c2, 0x624675fa, 0x4ba16b69, 0xda72c36d, 0x1cd3f643,
+    0x6f4b2fa7, 0x4a130dc2, 0xeb14fbf4, 0xdc73289c, 0xbf0e1dae, 0x5d9cade0, 0x692dad1f, 0xef2092a6,
+    0x6626886c, 0x84713cea, 0x16791a43, 0x59dca46c, 0xd547075c, 0xe74eaf62, 0xdfebc108, 0x74ca5afc,
+    0xc250332e, 0x14a8a503, 0x1cd5f087, 0xa52fb420, 0x8c5c522d, 0xf164ae60, 0x25b4dc7a, 0x3593ff0e,
+    0x1b8158cf, 0x88b0f0be, 0xbecdc1af, 0xeed10942, 0xb33c920a, 0x1dba97d7, 0xcb0c2f90, 0x74306e2f,
+    0x26b43a31, 0x0746323d, 0x39f2341d, 0xad651615, 0xa095c5a2, 0x306d8ed3, 0xa82f7da7, 0x5ba88822,
+    0x555bb98d, 0xcc83f41f, 0x9a17c779, 0x3e3e043d, 0xea7685d7, 0xc05ea083, 0x1de91769, 0x3a95b752,
+    0x927aef48, 0xda5f917f, 0x5ec9f11d, 0xbba892f7, 0x00e500d8, 0x75abf018, 0x758f64d0, 0xe360c1e4,
+    0xa01dc952, 0x36e2a8f6, 0x66dbe745, 0x69123bee, 0x9f23a6f9, 0x8cc08d19, 0x7ca12ca0, 0xf03bb1cf,
+    0x9d260cd0, 0xeab405cb, 0x1927353b, 0xd69e432a, 0xa676ee64, 0x1989b3b0, 0xe93b13e9, 0x08842817,
+    0xbbed5a5c, 0x4a5f2aa1, 0x5c50e45a, 0x36ebc1ea, 0x91115798, 0x68b52313, 0xc0871e6b, 0x08bf78af,
+    0xc776a7fb, 0xb4d760c8, 0x702cefe8, 0x352ecee2, 0x9f1b5b26, 0x7e50e3de, 0x06800c02, 0x10c19233,
+    0xfdd0044c, 0xe2f66cb5, 0x15cc7856, 0xcd6f833b, 0x0f73c516, 0x2b98531c, 0x1a29b9c9, 0xf2a61a21,
+    0x9612789e, 0xbd87b763, 0xdc158cc1, 0xb73bbbe6, 0x3072facd, 0xd5783b3b, 0x956603f8, 0x757a8c4d,
+    0x1605e649, 0x19250f39, 0x73630391, 0xa77df4f2, 0x8c44f729, 0xb4ac6852, 0xf9bb7841, 0xe7b58441,
+    0xd20eb89f, 0x0948d9c4, 0xd8f44fab, 0xa8a2b9d0, 0x32123149, 0xf7bc25d5, 0xeed720e8, 0x8d0e0173,
+    0x7695129f, 0xd627db9d, 0x07619d42, 0x4c52afa4, 0x51516473, 0xabcc8fc6, 0xf7189273, 0x9ccdc361,
+    0x687a6ca4, 0xb936aad0, 0x37a3c1f3, 0xcdb84b20, 0x207b312d, 0xec4d9e3f, 0xcb66a456, 0x0ec39257,
+    0xefe38951, 0xc256fe47, 0xd781a771, 0x9b237008, 0x49a12753, 0xd84a28b4, 0xaccd9c8c, 0xefc8de40,
+    0x7c87974b, 0xe7f9c8a2, 0xeb57e9d3, 0x86c788df, 0x6fa79ba4, 0xe8649237, 0x55ef5e7a, 0x1ee64eb0,
+    0x89be5a5c, 0xa210bd98, 0x80526d2a, 0x1a1c5109, 0xd188a52a, 0xbb37653c, 0x535ae4bb, 0x2e360f8e,
+    0xc41c9bcd, 0xf77e318e, 0x5b6ab861, 0xfe1db427, 0xddac4bf7, 0x9fca8d96, 0x5aaded42, 0x4b459024,
+    0x09f82c96, 0xfb90934e, 0x4848f8d1, 0x409f728c, 0xa35b5af0, 0xbb8d6e93, 0x98155b4d, 0x9e68c450,
+    0xd538556f, 0xbb3aa451, 0x3cb39691, 0x4b4bc09a, 0xfb49d9be, 0x544d8f94, 0x362e61d7, 0xb2ecb706,
+    0xa099aa80, 0xd96d7089, 0x26baed74, 0x5018c516, 0x8a401a84, 0x30e59384, 0x8f81d890, 0x567583c5,
+    0xcdca77bc, 0xc5b593a2, 0x07bbc1f4, 0x346406bb, 0x9619ec5b, 0x6a874e10, 0x87ebd375, 0x7136ac5a,
+    0xcda1ca5e, 0x7789d17b, 0xade6fcfd, 0x30bd0873, 0xa17edeed, 0x2ec9a379, 0x5271dfca, 0xf4505f09,
+    0x4a25d999, 0xf0296c8b, 0x2bff61c4, 0xaa6606a1, 0x170b7130, 0x07236183, 0x9f34b680, 0xfa636857,
+    0xcaa73afa, 0xded3ec96, 0xc5b1ba76, 0x3c153e20, 0x53cc7a95, 0x1a18c4bd, 0x2dff79de, 0x4a48174b,
+    0xc38de28b, 0xa2997a47, 0x6c24c61c, 0xce9fb133, 0xe27b192c, 0x86e32c01, 0x55c27ec2, 0xc7ffa785,
+    0x62cae678, 0xc938420a, 0x6634ba5c, 0x30b3501e, 0xb9a262a4, 0x38f9b789, 0x62fa37b8, 0x56b6e5f1,
+    0x8d9bc35f, 0x83507903, 0x7bcf8905, 0x3320248c, 0xac9a9b06, 0xdd3a551d, 0x794aa67d, 0xa2734b96,
+    0x0c31d9bd, 0xa37b8c44, 0x0908b87f, 0xc7b70d2a, 0x0e2c1f0d, 0x56f98799, 0x623d653e, 0x7049db1f,
+    0x36093f72, 0x3081909f, 0x12a3ef01, 0x2a12bb94, 0xcad07367, 0xdea5e8d5, 0xf2d98c8b, 0x06ec72c3,
+    0xe8427924, 0x009d0316, 0x431ebe63, 0x39e62af0, 0x5dc200b6, 0x1767bb4f, 0x402873a5, 0x93039955,
+    0x0a8fdebc, 0x201f5a16, 0x74cf9df2, 0xae4d50c8, 0xd5f6e215, 0xd7c67d85, 0x30e2e229, 0xeb13dee5,
+    0xefa109c0, 0x39908069, 0x810d1b57, 0x8b2a7560, 0xb5dc8c9d, 0xfb106af5, 0xf5321bc5, 0x5655b355,
+    0xec7646c9, 0x0b3cf40d, 0x024faefc, 0x1397bbfe, 0xfcaee229, 0xc7b02dca, 0x966f8f21, 0x8a06c730,
+    0x08c0c273, 0x29ecc0cd, 0x7c1ff528, 0xefd28502, 0x0cd1cbf6, 0x5153b9dc, 0x86be7f65, 0x69f236c6,
+    0xcb3aeaac, 0xc9a63aeb, 0xf5efc6e8, 0xb9ea262c, 0x7746ea63, 0xec90ef93, 0x5b9876c9, 0x5f7cd3ce,
+    0x5ad3f62a, 0x8218061d, 0x976e318d, 0xe680eb71, 0xbd09f71e, 0x5317f482, 0xab9703b2, 0x0804d2e5,
+    0x8c7c4769, 0x5d109297, 0xb0a99d22, 0xb1ce41a8, 0xef06406c, 0x99c45ece, 0xf179c314, 0x5e81d600,
+    0x238c2f06, 0xdca6d6e5, 0xf9d96dc3, 0x8d265e83, 0xa519c50b, 0xec8261fc, 0xe0c88a0a, 0x6db11b7f,
+    0xcc285316, 0xafa6038d, 0x3d429328, 0xd60c1f63, 0x9548e52f, 0x3085ee4f, 0xf7a1c489, 0xa5e13a74,
+    0x6f98b521, 0xaeb733d3, 0xb67fdba5, 0x0261a116, 0x1e472e27, 0x470b2eda, 0xccc6ef01, 0x2e0bd3a7,
+    0x3b2e2f71, 0x55084567, 0xad3beb51, 0xb0ed88fb, 0x76e955e9, 0x7bb3e17d, 0x5aae6bd0, 0xec070e41,
+    0xbe11acf0, 0x0e7b02b1, 0x17437c8a, 0x221ba5b3, 0xef94eb07, 0x07191d26, 0x5b8667d1, 0xd47d8467,
+    0xd1f239cc, 0x1f14195d, 0x50ad5e2e, 0xee9e3aac, 0xe36f9cbf, 0xad15af22, 0x9d4ce43b, 0x685cec7e,
+    0xea86a542, 0x278b9dfe, 0x2f8ec74a, 0x3b658cee, 0x226b0d05, 0xb5d5ae75, 0x9fb825b6
+};
+
+const int kJumpBits = int(sizeof(kJumpPolynomial) * 8);
+static_assert(kJumpBits == cRZRandomSuper::RELOAD_POLYNOMIAL_DEGREE, "Jump polynomial doesn't match the reload.");
+
+// Squares a polynomial modulo kRZReloadPolynomial in place, coefficients packed 32 to a word lowest degree first.
+void SquareJumpPolynomial(uint32_t *polynomial)
+{
+    const int words = kJumpBits / 32;
+    uint32_t square[words * 2 + 1] = {};
+
+    // Squaring over GF(2) only spreads the coefficients out as the cross terms cancel in pairs.
+    for (int i = 0; i < kJumpBits; ++i) {
+        if (polynomial[i / 32] & (1u << (i % 32))) {
+            square[i / 16] |= 1u << (i % 16 * 2);
+        }
+    }
+
+    // Reduces from the top down, each set coefficient cancelled by the modulus shifted up under it.
+    for (int i = (kJumpBits - 1) * 2; i >= kJumpBits; --i) {
+        if (square[i / 32] & (1u << (i % 32))) {
+            int shift = i - kJumpBits;
+            uint32_t *dst = square + shift / 32;
+            int bits = shift % 32;
+
+            for (int j = 0; j <= words; ++j) {
+                dst[j] ^= kRZReloadPolynomial[j] << bits;
+
+                if (bits != 0) {
+                    dst[j + 1] ^= kRZReloadPolynomial[j] >> (32 - bits);
+                }
+            }
+        }
+    }
+
+    std::memcpy(polynomial, square, sizeof(uint32_t) * words);
+}
+
+struct RZTwisterKernels
+{
+    void (*reload)(uint32_t *);
+    void (*temper)(uint32_t *, const uint32_t *, size_t);
+};
+
+inline uint32_t TwistWord(uint32_t x, uint32_t u, uint32_t v)
+{
+    uint32_t y = (u & 0x80000000) | (v & 0x7FFFFFFF);
+    return x ^ (y >> 1) ^ ((0 - (y & 1)) & cRZRandomSuper::XOR_MASK);
+}
+
+inline uint32_t TemperWord(uint32_t y)
+{
+    y ^= y >> cRZRandomSuper::TEMPERING_U;
+    y ^= (y & cRZRandomSuper::TEMPERING_B) << cRZRandomSuper::TEMPERING_S;
+    y ^= (y & cRZRandomSuper::TEMPERING_C) << cRZRandomSuper::TEMPERING_T;
+    y ^= y >> cRZRandomSuper::TEMPERING_L;
+
+    return y;
+}
+
+// The original second loop ran one word past the end of the state, twisting the last word against the low word of
+// mpNext, which is always even, before the last word was recomputed from that result. Only the top bit of the
+// intermediate survives and it always matches the freshly twisted word TWIST_PERIOD - 1, so use that directly.
+inline void ReloadLast(uint32_t *mt)
+{
+    uint32_t x = mt[cRZRandomSuper::TWIST_PERIOD - 1];
+    mt[cRZRandomSuper::TWIST_SIZE - 1] = TwistWord(x, x, mt[0]);
+}
+
+void ReloadScalar(uint32_t *mt)
+{
+    // The loop is unrolled into 3 parts to avoid the need for a modulo operation.
+    for (unsigned i = 0; i < cRZRandomSuper::TWIST_DIFF; ++i) {
+        mt[i] = TwistWord(mt[i + cRZRandomSuper::TWIST_PERIOD], mt[i], mt[i + 1]);
+    }
+
+    for (unsigned i = cRZRandomSuper::TWIST_DIFF; i < cRZRandomSuper::TWIST_SIZE - 1; ++i) {
+        mt[i] = TwistWord(mt[i - cRZRandomSuper::TWIST_DIFF], mt[i], mt[i + 1]);
+    }
+
+    ReloadLast(mt);
+}
+
+void TemperScalar(uint32_t *dst, const uint32_t *src, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = TemperWord(src[i]);
+    }
+}
+
+#ifdef HAVE_X86_SIMD
+// Each new word depends on the old value of the next word and a word at least TWIST_DIFF positions away, so vector
+// reloads see the same inputs the scalar loops do as long as a block and its neighbours are loaded before it is stored.
+__target_attr("sse2") void TemperSSE2(uint32_t *dst, const uint32_t *src, size_t count)
+{
+    const __m128i mask_b = _mm_set1_epi32(int(cRZRandomSuper::TEMPERING_B));
+    const __m128i mask_c = _mm_set1_epi32(int(cRZRandomSuper::TEMPERING_C));
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        y = _mm_xor_si128(y, _mm_srli_epi32(y, cRZRandomSuper::TEMPERING_U));
+        y = _mm_xor_si128(y, _mm_slli_epi32(_mm_and_si128(y, mask_b), cRZRandomSuper::TEMPERING_S));
+        y = _mm_xor_si128(y, _mm_slli_epi32(_mm_and_si128(y, mask_c), cRZRandomSuper::TEMPERING_T));
+        y = _mm_xor_si128(y, _mm_srli_epi32(y, cRZRandomSuper::TEMPERING_L));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), y);
+    }
+
+    TemperScalar(dst + i, src + i, count - i);
+}
+
+__target_attr("sse2") inline __m128i TwistSSE2(__m128i x, __m128i u, __m128i v)
+{
+    const __m128i upper = _mm_set1_epi32(int(0x80000000));
+    const __m128i matrix = _mm_set1_epi32(int(cRZRandomSuper::XOR_MASK));
+    __m128i y = _mm_or_si128(_mm_and_si128(u, upper), _mm_andnot_si128(upper, v));
+    __m128i odd = _mm_srai_epi32(_mm_slli_epi32(y, 31), 31);
+
+    return _mm_xor_si128(_mm_xor_si128(x, _mm_srli_epi32(y, 1)), _mm_and_si128(odd, matrix));
+}
+
+__target_attr("sse2") void ReloadSSE2(uint32_t *mt)
+{
+    unsigned i = 0;
+
+    for (; i + 4 <= cRZRandomSuper::TWIST_DIFF; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mt + i + cRZRandomSuper::TWIST_PERIOD));
+        __m128i u = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mt + i));
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mt + i + 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(mt + i), TwistSSE2(x, u, v));
+    }
+
+    for (; i < cRZRandomSuper::TWIST_DIFF; ++i) {
+        mt[i] = TwistWord(mt[i + cRZRandomSuper::TWIST_PERIOD], mt[i], mt[i + 1]);
+    }
+
+    for (; i + 4 <= cRZRandomSuper::TWIST_SIZE - 1; i += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mt + i - cRZRandomSuper::TWIST_DIFF));
+        __m128i u = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mt + i));
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mt + i + 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(mt + i), TwistSSE2(x, u, v));
+    }
+
+    for (; i < cRZRandomSuper::TWIST_SIZE - 1; ++i) {
+        mt[i] = TwistWord(mt[i - cRZRandomSuper::TWIST_DIFF], mt[i], mt[i + 1]);
+    }
+
+    ReloadLast(mt);
+}
+
+__target_attr("avx2") void TemperAVX2(uint32_t *dst, const uint32_t *src, size_t count)
+{
+    const __m256i mask_b = _mm256_set1_epi32(int(cRZRandomSuper::TEMPERING_B));
+    const __m256i mask_c = _mm256_set1_epi32(int(cRZRandomSuper::TEMPERING_C));
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        y = _mm256_xor_si256(y, _mm256_srli_epi32(y, cRZRandomSuper::TEMPERING_U));
+        y = _mm256_xor_si256(y, _mm256_slli_epi32(_mm256_and_si256(y, mask_b), cRZRandomSuper::TEMPERING_S));
+        y = _mm256_xor_si256(y, _mm256_slli_epi32(_mm256_and_si256(y, mask_c), cRZRandomSuper::TEMPERING_T));
+        y = _mm256_xor_si256(y, _mm256_srli_epi32(y, cRZRandomSuper::TEMPERING_L));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), y);
+    }
+
+    TemperScalar(dst + i, src + i, count - i);
+}
+
+__target_attr("avx2") inline __m256i TwistAVX2(__m256i x, __m256i u, __m256i v)
+{
+    const __m256i upper = _mm256_set1_epi32(int(0x80000000));
+    const __m256i matrix = _mm256_set1_epi32(int(cRZRandomSuper::XOR_MASK));
+    __m256i y = _mm256_or_si256(_mm256_and_si256(u, upper), _mm256_andnot_si256(upper, v));
+    __m256i odd = _mm256_srai_epi32(_mm256_slli_epi32(y, 31), 31);
+
+    return _mm256_xor_si256(_mm256_xor_si256(x, _mm256_srli_epi32(y, 1)), _mm256_and_si256(odd, matrix));
+}
+
+__target_attr("avx2") void ReloadAVX2(uint32_t *mt)
+{
+    unsigned i = 0;
+
+    for (; i + 8 <= cRZRandomSuper::TWIST_DIFF; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mt + i + cRZRandomSuper::TWIST_PERIOD));
+        __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mt + i));
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mt + i + 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(mt + i), TwistAVX2(x, u, v));
+    }
+
+    for (; i < cRZRandomSuper::TWIST_DIFF; ++i) {
+        mt[i] = TwistWord(mt[i + cRZRandomSuper::TWIST_PERIOD], mt[i], mt[i + 1]);
+    }
+
+    for (; i + 8 <= cRZRandomSuper::TWIST_SIZE - 1; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mt + i - cRZRandomSuper::TWIST_DIFF));
+        __m256i u = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mt + i));
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mt + i + 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(mt + i), TwistAVX2(x, u, v));
+    }
+
+    for (; i < cRZRandomSuper::TWIST_SIZE - 1; ++i) {
+        mt[i] = TwistWord(mt[i - cRZRandomSuper::TWIST_DIFF], mt[i], mt[i + 1]);
+    }
+
+    ReloadLast(mt);
+}
+#endif
+
+RZTwisterKernels SelectKernels()
+{
+    RZTwisterKernels kernels = { ReloadScalar, TemperScalar };
+#ifdef HAVE_X86_SIMD
+    unsigned features = cpu_features();
+
+    if (features & CPU_FEATURE_AVX2) {
+        kernels.reload = ReloadAVX2;
+        kernels.temper = TemperAVX2;
+    } else if (features & CPU_FEATURE_SSE2) {
+        kernels.reload = ReloadSSE2;
+        kernels.temper = TemperSSE2;
+    }
+#endif
+    return kernels;
+}
+
+const RZTwisterKernels &Kernels()
+{
+    static const RZTwisterKernels kernels = SelectKernels();
+    return kernels;
+}
+
+// Tables for Marsaglia and Tsang's ziggurat with 128 layers for the normal distribution and 256 for the exponential.
+struct RZZigguratTables
+{
+    RZZigguratTables()
+    {
+        const double m1 = 2147483648.0;
+        const double m2 = 4294967296.0;
+        double dn = 3.442619855899;
+        double tn = dn;
+        double vn = 9.91256303526217e-3;
+        double q = vn / std::exp(-0.5 * dn * dn);
+
+        mKn[0] = uint32_t((dn / q) * m1);
+        mKn[1] = 0;
+        mWn[0] = q / m1;
+        mWn[127] = dn / m1;
+        mFn[0] = 1.0;
+        mFn[127] = std::exp(-0.5 * dn * dn);
+
+        for (int i = 126; i >= 1; --i) {
+            dn = std::sqrt(-2.0 * std::log(vn / dn + std::exp(-0.5 * dn * dn)));
+            mKn[i + 1] = uint32_t((dn / tn) * m1);
+            tn = dn;
+            mFn[i] = std::exp(-0.5 * dn * dn);
+            mWn[i] = dn / m1;
+        }
+
+        double de = 7.697117470131487;
+        double te = de;
+        double ve = 3.949659822581572e-3;
+        q = ve / std::exp(-de);
+
+        mKe[0] = uint32_t((de / q) * m2);
+        mKe[1] = 0;
+        mWe[0] = q / m2;
+        mWe[255] = de / m2;
+        mFe[0] = 1.0;
+        mFe[255] = std::exp(-de);
+
+        for (int i = 254; i >= 1; --i) {
+            de = -std::log(ve / de + std::exp(-de));
+            mKe[i + 1] = uint32_t((de / te) * m2);
+            te = de;
+            mFe[i] = std::exp(-de);
+            mWe[i] = de / m2;
+        }
+    }
+
+    uint32_t mKn[128];
+    double mWn[128];
+    double mFn[128];
+    uint32_t mKe[256];
+    double mWe[256];
+    double mFe[256];
+};
+
+const RZZigguratTables &ZigguratTables()
+{
+    static const RZZigguratTables tables;
+    return tables;
+}
+
+} // namespace
+
+// Hands out values from the generator a block at a time so the samplers get the benefit of Fill. Layer indices come
+// from their own values rather than the low bits of the sample so the two stay independent. Blocks never span a reload
+// so whatever is left over can be handed back, the generator only advances by the values the samplers used.
+class RZBlockSource
+{
+public:
+    RZBlockSource(cRZRandomSuper &rng) : mRng(rng), mnPos(0), mnCount(0), mnLayerBits(0), mnLayers(0) {}
+
+    ~RZBlockSource()
+    {
+        mRng.mpNext -= mnCount - mnPos;
+        mRng.mnRemaining += int32_t(mnCount - mnPos);
+    }
+
+    uint32_t Next()
+    {
+        if (mnPos == mnCount) {
+            Refill();
+        }
+
+        return mValues[mnPos++];
+    }
+
+    uint32_t NextLayer()
+    {
+        if (mnLayers == 0) {
+            mnLayerBits = Next();
+            mnLayers = 4;
+        }
+
+        uint32_t layer = mnLayerBits & 0xFF;
+        mnLayerBits >>= 8;
+        --mnLayers;
+
+        return layer;
+    }
+
+    // Open interval so the result can always be passed to log.
+    double NextOpen() { return (Next() + 0.5) * (1.0 / 4294967296.0); }
+
+private:
+    void Refill()
+    {
+        if (mRng.mnRemaining <= 0) {
+            mRng.Reload();
+        }
+
+        mnCount = size_t(mRng.mnRemaining) < kFillBlock ? size_t(mRng.mnRemaining) : kFillBlock;
+        mnPos = 0;
+        Kernels().temper(mValues, mRng.mpNext, mnCount);
+        mRng.mpNext += mnCount;
+        mRng.mnRemaining -= int32_t(mnCount);
+    }
+
+private:
+    cRZRandomSuper &mRng;
+    uint32_t mValues[kFillBlock];
+    size_t mnPos;
+    size_t mnCount;
+    uint32_t mnLayerBits;
+    int mnLayers;
+};
+
+namespace
+{
+double ZigguratNormal(RZBlockSource &source, const RZZigguratTables &tables)
+{
+    const double r = 3.442620;
+
+    for (;;) {
+        int32_t hz = int32_t(source.Next());
+        uint32_t iz = source.NextLayer() & 127;
+        uint32_t abs_hz = hz < 0 ? 0 - uint32_t(hz) : uint32_t(hz);
+        double x = hz * tables.mWn[iz];
+
+        if (abs_hz < tables.mKn[iz]) {
+            return x;
+        }
+
+        // The base layer samples the tail beyond r directly.
+        if (iz == 0) {
+            double y;
+
+            do {
+                x = -std::log(source.NextOpen()) * (1.0 / r);
+                y = -std::log(source.NextOpen());
+            } while (y + y < x * x);
+
+            return hz > 0 ? r + x : -r - x;
+        }
+
+        if (tables.mFn[iz] + source.NextOpen() * (tables.mFn[iz - 1] - tables.mFn[iz]) < std::exp(-0.5 * x * x)) {
+            return x;
+        }
+    }
+}
+
+double ZigguratExponential(RZBlockSource &source, const RZZigguratTables &tables)
+{
+    for (;;) {
+        uint32_t jz = source.Next();
+        uint32_t iz = source.NextLayer();
+        double x = jz * tables.mWe[iz];
+
+        if (jz < tables.mKe[iz]) {
+            return x;
+        }
+
+        if (iz == 0) {
+            return 7.69711 - std::log(source.NextOpen());
+        }
+
+        if (tables.mFe[iz] + source.NextOpen() * (tables.mFe[iz - 1] - tables.mFe[iz]) < std::exp(-x)) {
+            return x;
+        }
+    }
+}
+} // namespace
+
 cRZRandomSuper::cRZRandomSuper(uint32_t seed) : mpNext(nullptr), mnRemaining(624)
 {
     Seed(seed);
 }
 
+cRZRandomSuper::cRZRandomSuper(const cRZRandomSuper &that)
+{
+    *this = that;
+}
+
+cRZRandomSuper &cRZRandomSuper::operator=(const cRZRandomSuper &that)
+{
+    // mpNext points into the state so has to be rebased rather than copied.
+    std::memcpy(mTwister, that.mTwister, sizeof(mTwister));
+    mpNext = that.mpNext != nullptr ? mTwister + (that.mpNext - that.mTwister) : nullptr;
+    mnRemaining = that.mnRemaining;
+
+    return *this;
+}
+
 void cRZRandomSuper::Seed(uint32_t seed)
 {
     // Generate a seed if one isn't provided.
@@ -47,13 +651,7 @@ uint32_t cRZRandomSuper::RandomUint32Uniform()
         --mnRemaining;
     }
 
-    uint32_t y = *mpNext++;
-    y ^= y >> TEMPERING_U;
-    y ^= (y & TEMPERING_B) << TEMPERING_S;
-    y ^= (y & TEMPERING_C) << TEMPERING_T;
-    y ^= y >> TEMPERING_L;
-
-    return y;
+    return TemperWord(*mpNext++);
 }
 
 uint32_t cRZRandomSuper::RandomUint32Uniform(uint32_t scale)
@@ -61,6 +659,25 @@ uint32_t cRZRandomSuper::RandomUint32Uniform(uint32_t scale)
     return (scale * uint64_t(RandomUint32Uniform())) >> 32;
 }
 
+uint32_t cRZRandomSuper::RandomUint32Bounded(uint32_t range)
+{
+    // Lemire's multiply and shift with rejection of the few low products that would bias the result, the division to
+    // find the threshold is only needed when the product lands in the possibly biased region.
+    uint64_t m = uint64_t(RandomUint32Uniform()) * range;
+    uint32_t low = uint32_t(m);
+
+    if (low < range) {
+        uint32_t threshold = (0 - range) % range;
+
+        while (low < threshold) {
+            m = uint64_t(RandomUint32Uniform()) * range;
+            low = uint32_t(m);
+        }
+    }
+
+    return uint32_t(m >> 32);
+}
+
 int32_t cRZRandomSuper::RandomSint32RangeUniform(int32_t min, int32_t max)
 {
     return min + RandomUint32Uniform(max - min);
@@ -71,33 +688,164 @@ double cRZRandomSuper::RandomDoubleUniform()
     return (int32_t(RandomUint32Uniform()) * 2.328306436538696e-10) + 0.5;
 }
 
+double cRZRandomSuper::RandomDouble53()
+{
+    uint32_t a = RandomUint32Uniform() >> 5;
+    uint32_t b = RandomUint32Uniform() >> 6;
+
+    return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+}
+
 double cRZRandomSuper::RandomDoubleRangeUniform(double min, double max)
 {
     return (RandomDoubleUniform() * (max - min)) + min;
 }
 
-void cRZRandomSuper::Reload()
+void cRZRandomSuper::Fill(uint32_t *out, size_t count)
 {
-    // The loop is unrolled into 3 parts to avoid the need for a modulo operation.
-    for (int i = 0; i < TWIST_DIFF; ++i) {
-        uint32_t y = (mTwister[i] & 0x80000000) | (mTwister[i + 1] & 0x7FFFFFFF);
-        mTwister[i] = mTwister[i + TWIST_PERIOD] ^ (y >> 1) ^ (((int32_t(y) << 31) >> 31) & XOR_MASK);
+    const RZTwisterKernels &kernels = Kernels();
+
+    while (count != 0) {
+        if (mnRemaining <= 0) {
+            Reload();
+        }
+
+        size_t block = count < size_t(mnRemaining) ? count : size_t(mnRemaining);
+        kernels.temper(out, mpNext, block);
+        mpNext += block;
+        mnRemaining -= int32_t(block);
+        out += block;
+        count -= block;
+    }
+}
+
+void cRZRandomSuper::FillRange(int32_t *out, size_t count, int32_t min, int32_t max)
+{
+    uint32_t values[kFillBlock];
+    uint32_t scale = uint32_t(max) - uint32_t(min);
+
+    while (count != 0) {
+        size_t block = count < kFillBlock ? count : kFillBlock;
+        Fill(values, block);
+
+        for (size_t i = 0; i < block; ++i) {
+            out[i] = int32_t(uint32_t(min) + uint32_t((scale * uint64_t(values[i])) >> 32));
+        }
+
+        out += block;
+        count -= block;
     }
+}
+
+void cRZRandomSuper::FillDoubles(double *out, size_t count)
+{
+    uint32_t values[kFillBlock];
+
+    while (count != 0) {
+        size_t block = count < kFillBlock ? count : kFillBlock;
+        Fill(values, block);
+
+        for (size_t i = 0; i < block; ++i) {
+            out[i] = (int32_t(values[i]) * 2.328306436538696e-10) + 0.5;
+        }
 
-    for (int i = TWIST_DIFF; i < TWIST_SIZE; ++i) {
-        uint32_t y = (mTwister[i] & 0x80000000) | (mTwister[i + 1] & 0x7FFFFFFF);
-        mTwister[i] = mTwister[i - TWIST_DIFF] ^ (y >> 1) ^ (((int32_t(y) << 31) >> 31) & XOR_MASK);
+        out += block;
+        count -= block;
     }
+}
+
+void cRZRandomSuper::FillDoubles(double *out, size_t count, double min, double max)
+{
+    FillDoubles(out, count);
+
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = (out[i] * (max - min)) + min;
+    }
+}
+
+void cRZRandomSuper::FillGaussian(double *out, size_t count, double mean, double stddev)
+{
+    const RZZigguratTables &tables = ZigguratTables();
+    RZBlockSource source(*this);
+
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = mean + stddev * ZigguratNormal(source, tables);
+    }
+}
+
+void cRZRandomSuper::FillExponential(double *out, size_t count, double rate)
+{
+    const RZZigguratTables &tables = ZigguratTables();
+    RZBlockSource source(*this);
+    double scale = 1.0 / rate;
 
-    uint32_t y = (mTwister[TWIST_SIZE - 1] & 0x80000000) | (mTwister[0] & 0x7FFFFFFF);
-    mTwister[TWIST_SIZE - 1] = mTwister[TWIST_PERIOD - 1] ^ (y >> 1) ^ (((int32_t(y) << 31) >> 31) & XOR_MASK);
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = ZigguratExponential(source, tables) * scale;
+    }
+}
+
+void cRZRandomSuper::Jump()
+{
+    Jump(kJumpPolynomial, kJumpBits);
+}
+
+void cRZRandomSuper::Jump(const uint32_t *polynomial, int bits)
+{
+    const RZTwisterKernels &kernels = Kernels();
+    uint32_t state[TWIST_SIZE] = {};
+
+    // Evaluates the polynomial at Reload by Horner's method, Reload being linear so it can be applied to the sum.
+    for (int i = bits - 1; i >= 0; --i) {
+        kernels.reload(state);
+
+        if (polynomial[i / 32] & (1u << (i % 32))) {
+            for (unsigned j = 0; j < TWIST_SIZE; ++j) {
+                state[j] ^= mTwister[j];
+            }
+        }
+    }
+
+    // The position within the state is left alone so output continues from the same offset in the jumped state.
+    std::memcpy(mTwister, state, sizeof(mTwister));
+}
+
+void cRZRandomSuper::Jump(uint32_t count)
+{
+    uint32_t power[kJumpBits / 32];
+    std::memcpy(power, kJumpPolynomial, sizeof(power));
+
+    // Jumps by each power of two in count, squaring x^(2^64) into x^(2^65) and so on as it goes.
+    while (count != 0) {
+        if (count & 1) {
+            Jump(power, kJumpBits);
+        }
+
+        count >>= 1;
+
+        if (count != 0) {
+            SquareJumpPolynomial(power);
+        }
+    }
+}
+
+cRZRandomSuper cRZRandomSuper::Split()
+{
+    cRZRandomSuper split(*this);
+    Jump();
+
+    return split;
+}
+
+void cRZRandomSuper::Reload()
+{
+    Kernels().reload(mTwister);
     mnRemaining = TWIST_SIZE;
     mpNext = mTwister;
 }
 
 uint32_t cRZRandomSuper::Hash(int32_t val1, int32_t val2)
 {
-    static int _incrementor;
+    static volatile uint32_t _incrementor;
     uint8_t byte1[sizeof(val1)];
     uint8_t byte2[sizeof(val2)];
 
@@ -116,5 +864,6 @@ uint32_t cRZRandomSuper::Hash(int32_t val1, int32_t val2)
         hash2 = 257 * hash2 + byte2[i];
     }
 
-    return hash2 ^ (hash1 + _incrementor++);
+    // Generators can be seeded from several threads at once so the increment has to be atomic.
+    return hash2 ^ (hash1 + int32_t(RZThreadSafeAdd(_incrementor, 1) - 1));
 }
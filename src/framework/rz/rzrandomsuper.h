@@ -12,10 +12,18 @@
  */
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
+/**
+ * @brief Minimal polynomial of the cRZRandomSuper reload over GF(2), RELOAD_POLYNOMIAL_DEGREE + 1 coefficients lowest
+ * degree first. Reducing x^n modulo it gives a polynomial that advances a generator by n reloads.
+ */
+extern const uint32_t kRZReloadPolynomial[];
+
 class cRZRandomSuper
 {
+public:
     enum
     {
         TWIST_SIZE = 624,
@@ -28,10 +36,13 @@ class cRZRandomSuper
         TEMPERING_C = 0xFFFFDF8C,
         TEMPERING_L = 18,
         XOR_MASK = 0x9908B0DF,
+        RELOAD_POLYNOMIAL_DEGREE = 19936,
     };
 
-public:
     cRZRandomSuper(uint32_t seed = UINT32_MAX);
+    cRZRandomSuper(const cRZRandomSuper &that);
+
+    cRZRandomSuper &operator=(const cRZRandomSuper &that);
 
     /**
      * @brief Seeds the random number generator.
@@ -49,6 +60,13 @@ public:
      * @return Random value.
      */
     uint32_t RandomUint32Uniform(uint32_t scale);
+    /**
+     * @brief Generates a random 32bit unsigned integer without the bias RandomUint32Uniform(scale) has, occasionally
+     * drawing more than one value from the generator.
+     * @param range Value returned will be smaller than this unless it is 0.
+     * @return Random value.
+     */
+    uint32_t RandomUint32Bounded(uint32_t range);
     /**
      * @brief Generates a random 32bit unsigned integer within a range.
      * @param min Value returned should be no smaller than this.
@@ -61,6 +79,12 @@ public:
      * @return Random value.
      */
     double RandomDoubleUniform();
+    /**
+     * @brief Generates a random 64bit floating point value using the full 53bit mantissa, drawing two values from the
+     * generator.
+     * @return Random value in the range [0, 1).
+     */
+    double RandomDouble53();
     /**
      * @brief Generates a random 64bit floating point value.
      * @param min Value returned should be no smaller than this.
@@ -68,8 +92,80 @@ public:
      * @return Random value.
      */
     double RandomDoubleRangeUniform(double min, double max);
+    /**
+     * @brief Fills a buffer with random 32bit unsigned integers, the same sequence RandomUint32Uniform would produce.
+     * @param out Buffer to fill.
+     * @param count Number of values to generate.
+     */
+    void Fill(uint32_t *out, size_t count);
+    /**
+     * @brief Fills a buffer with random 32bit signed integers, the same sequence RandomSint32RangeUniform would produce.
+     * @param out Buffer to fill.
+     * @param count Number of values to generate.
+     * @param min Values generated should be no smaller than this.
+     * @param max Values generated should be no larger than this.
+     */
+    void FillRange(int32_t *out, size_t count, int32_t min, int32_t max);
+    /**
+     * @brief Fills a buffer with random 64bit floating point values, the same sequence RandomDoubleUniform would produce.
+     * @param out Buffer to fill.
+     * @param count Number of values to generate.
+     */
+    void FillDoubles(double *out, size_t count);
+    /**
+     * @brief Fills a buffer with random 64bit floating point values, the same sequence RandomDoubleRangeUniform would
+     * produce.
+     * @param out Buffer to fill.
+     * @param count Number of values to generate.
+     * @param min Values generated should be no smaller than this.
+     * @param max Values generated should be no larger than this.
+     */
+    void FillDoubles(double *out, size_t count, double min, double max);
+    /**
+     * @brief Fills a buffer with normally distributed values using the ziggurat method. The generator advances by
+     * exactly the values the samples consumed, which varies from sample to sample.
+     * @param out Buffer to fill.
+     * @param count Number of values to generate.
+     * @param mean Mean of the distribution.
+     * @param stddev Standard deviation of the distribution.
+     */
+    void FillGaussian(double *out, size_t count, double mean = 0.0, double stddev = 1.0);
+    /**
+     * @brief Fills a buffer with exponentially distributed values using the ziggurat method. The generator advances by
+     * exactly the values the samples consumed, which varies from sample to sample.
+     * @param out Buffer to fill.
+     * @param count Number of values to generate.
+     * @param rate Rate parameter of the distribution, the mean of the values is its reciprocal.
+     */
+    void FillExponential(double *out, size_t count, double rate = 1.0);
+    /**
+     * @brief Advances the generator by 2^64 reloads of the twister state, TWIST_SIZE * 2^64 values, without generating
+     * them. Costs roughly as much as twenty thousand reloads.
+     */
+    void Jump();
+    /**
+     * @brief Advances the generator by evaluating a polynomial at the reload, x^n modulo kRZReloadPolynomial advances it
+     * by n reloads. Costs roughly as much as one reload per coefficient.
+     * @param polynomial Coefficients packed 32 to a word, lowest degree first.
+     * @param bits Number of coefficients.
+     */
+    void Jump(const uint32_t *polynomial, int bits);
+    /**
+     * @brief Advances the generator as if Jump() had been called count times. Costs roughly one Jump() per set bit of
+     * count plus a polynomial squaring per bit below the highest set one.
+     * @param count Number of jumps to advance by.
+     */
+    void Jump(uint32_t count);
+    /**
+     * @brief Splits off a generator for another worker that won't overlap with this one for TWIST_SIZE * 2^64 values.
+     * @return Generator producing the next TWIST_SIZE * 2^64 values this generator would have, this generator then
+     * continues after them.
+     */
+    cRZRandomSuper Split();
 
 private:
+    friend class RZBlockSource;
+
     void Reload();
     uint32_t Hash(int32_t val1, int32_t val2);
 
@@ -0,0 +1,99 @@
+/**
+ * @file
+ *
+ * @brief An implementation for reader writer lock objects.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+#include "igzreadwritelock.h"
+
+#ifndef _WIN32
+#include "rzcriticalsection.h"
+#include <atomic>
+#endif
+
+/**
+ * @brief Scoped shared lock for cIGZReadWriteLock objects.
+ */
+class cRZReadLock
+{
+public:
+    cRZReadLock(cIGZReadWriteLock &lock) : mLock(lock) { mLock.LockRead(); }
+    ~cRZReadLock() { mLock.UnlockRead(); }
+
+private:
+    cIGZReadWriteLock &mLock;
+};
+
+/**
+ * @brief Scoped exclusive lock for cIGZReadWriteLock objects.
+ */
+class cRZWriteLock
+{
+public:
+    cRZWriteLock(cIGZReadWriteLock &lock) : mLock(lock) { mLock.LockWrite(); }
+    ~cRZWriteLock() { mLock.UnlockWrite(); }
+
+private:
+    cIGZReadWriteLock &mLock;
+};
+
+/**
+ * @brief Writer preferring lock, new readers wait once a writer is waiting so a steady stream of readers can't starve
+ * writers. Neither mode is recursive.
+ */
+class cRZReadWriteLock : public cIGZReadWriteLock
+{
+public:
+    cRZReadWriteLock();
+    virtual ~cRZReadWriteLock();
+
+    /**
+     * @brief Releases the object.
+     * @return Always 0.
+     */
+    virtual int32_t Release() override;
+    /**
+     * @brief Acquire shared access, will block while a writer holds or is waiting for the lock.
+     */
+    virtual void LockRead() override;
+    /**
+     * @brief Acquire shared access, will not block.
+     * @return If shared access was acquired.
+     */
+    virtual bool TryLockRead() override;
+    /**
+     * @brief Release shared access.
+     */
+    virtual void UnlockRead() override;
+    /**
+     * @brief Acquire exclusive access, will block.
+     */
+    virtual void LockWrite() override;
+    /**
+     * @brief Acquire exclusive access, will not block.
+     * @return If exclusive access was acquired.
+     */
+    virtual bool TryLockWrite() override;
+    /**
+     * @brief Release exclusive access.
+     */
+    virtual void UnlockWrite() override;
+
+private:
+#ifdef _WIN32
+    alignas(64) void *mSRWLock;
+    alignas(64) volatile long mnWritersWaiting;
+#else
+    // Reader count, waiting writer count and flags share a word on their own cache line so readers touch nothing else.
+    alignas(64) std::atomic<uint32_t> mnState;
+    // Writers take turns through this so only one at a time waits for the readers to drain.
+    alignas(64) cRZCriticalSection mWriterLock;
+#endif
+};
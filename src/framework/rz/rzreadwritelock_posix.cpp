@@ -0,0 +1,148 @@
+/**
+ * @file
+ *
+ * @brief An implementation for reader writer lock objects.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzreadwritelock.h"
+#include "rzfutex.h"
+
+namespace
+{
+const int kSpinCount = 128;
+
+const uint32_t kReaderMask = 0x000FFFFF;
+const uint32_t kWriterUnit = 0x00100000;
+const uint32_t kWriterMask = 0x3FF00000;
+const uint32_t kWriterActive = 0x40000000;
+const uint32_t kWaiters = 0x80000000;
+
+// Flags that there are sleepers before sleeping so unlocking only makes a syscall when someone needs waking.
+void Wait(std::atomic<uint32_t> &state, uint32_t value)
+{
+    if (!(value & kWaiters)) {
+        if (!state.compare_exchange_strong(value, value | kWaiters, std::memory_order_relaxed)) {
+            return;
+        }
+
+        value |= kWaiters;
+    }
+
+    RZFutexWait(state, value);
+}
+
+void WakeAll(std::atomic<uint32_t> &state)
+{
+    state.fetch_and(~kWaiters, std::memory_order_relaxed);
+    RZFutexWake(state, INT32_MAX);
+}
+} // namespace
+
+cRZReadWriteLock::cRZReadWriteLock() : mnState(0) {}
+
+cRZReadWriteLock::~cRZReadWriteLock() {}
+
+int32_t cRZReadWriteLock::Release()
+{
+    delete this;
+    return 0;
+}
+
+void cRZReadWriteLock::LockRead()
+{
+    for (int spin = 0;; ++spin) {
+        uint32_t state = mnState.load(std::memory_order_relaxed);
+
+        if (!(state & (kWriterMask | kWriterActive))) {
+            if (mnState.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return;
+            }
+        } else if (spin < kSpinCount) {
+            RZCpuRelax();
+        } else {
+            Wait(mnState, state);
+        }
+    }
+}
+
+bool cRZReadWriteLock::TryLockRead()
+{
+    uint32_t state = mnState.load(std::memory_order_relaxed);
+
+    while (!(state & (kWriterMask | kWriterActive))) {
+        if (mnState.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void cRZReadWriteLock::UnlockRead()
+{
+    uint32_t state = mnState.fetch_sub(1, std::memory_order_release);
+
+    // Only a writer waiting for the readers to drain can be asleep while readers hold the lock.
+    if ((state & kReaderMask) == 1 && (state & kWaiters)) {
+        WakeAll(mnState);
+    }
+}
+
+void cRZReadWriteLock::LockWrite()
+{
+    // Counting the writer in before queueing on the writer lock is what holds back new readers.
+    mnState.fetch_add(kWriterUnit, std::memory_order_relaxed);
+    mWriterLock.Lock();
+
+    for (int spin = 0;; ++spin) {
+        uint32_t state = mnState.load(std::memory_order_relaxed);
+
+        if (!(state & (kReaderMask | kWriterActive))) {
+            if (mnState.compare_exchange_weak(
+                    state, state | kWriterActive, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return;
+            }
+        } else if (spin < kSpinCount) {
+            RZCpuRelax();
+        } else {
+            Wait(mnState, state);
+        }
+    }
+}
+
+bool cRZReadWriteLock::TryLockWrite()
+{
+    if (!mWriterLock.TryLock()) {
+        return false;
+    }
+
+    uint32_t state = mnState.load(std::memory_order_relaxed);
+
+    // Writers queued on the writer lock don't block a try, it's next in line as soon as it holds the writer lock.
+    while (!(state & (kReaderMask | kWriterActive))) {
+        if (mnState.compare_exchange_weak(
+                state, (state + kWriterUnit) | kWriterActive, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+    mWriterLock.Unlock();
+
+    return false;
+}
+
+void cRZReadWriteLock::UnlockWrite()
+{
+    uint32_t state = mnState.fetch_sub(kWriterUnit + kWriterActive, std::memory_order_release);
+    mWriterLock.Unlock();
+
+    if (state & kWaiters) {
+        WakeAll(mnState);
+    }
+}
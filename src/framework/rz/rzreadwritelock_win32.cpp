@@ -0,0 +1,76 @@
+/**
+ * @file
+ *
+ * @brief An implementation for reader writer lock objects.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzreadwritelock.h"
+#include <windows.h>
+
+static_assert(sizeof(SRWLOCK) == sizeof(void *), "SRWLOCK must fit in the storage reserved for it");
+
+namespace
+{
+// Yields a reader gives a waiting writer before blocking in the SRW lock instead of burning a core for the whole hold.
+const int kReaderYieldCount = 16;
+} // namespace
+
+cRZReadWriteLock::cRZReadWriteLock() : mSRWLock(nullptr), mnWritersWaiting(0)
+{
+    InitializeSRWLock(reinterpret_cast<PSRWLOCK>(&mSRWLock));
+}
+
+cRZReadWriteLock::~cRZReadWriteLock() {}
+
+int32_t cRZReadWriteLock::Release()
+{
+    delete this;
+    return 0;
+}
+
+void cRZReadWriteLock::LockRead()
+{
+    // SRW locks don't promise to prefer writers so new readers briefly step aside while any writer is waiting.
+    for (int i = 0; i < kReaderYieldCount && mnWritersWaiting != 0; ++i) {
+        SwitchToThread();
+    }
+
+    AcquireSRWLockShared(reinterpret_cast<PSRWLOCK>(&mSRWLock));
+}
+
+bool cRZReadWriteLock::TryLockRead()
+{
+    if (mnWritersWaiting != 0) {
+        return false;
+    }
+
+    return TryAcquireSRWLockShared(reinterpret_cast<PSRWLOCK>(&mSRWLock)) != 0;
+}
+
+void cRZReadWriteLock::UnlockRead()
+{
+    ReleaseSRWLockShared(reinterpret_cast<PSRWLOCK>(&mSRWLock));
+}
+
+void cRZReadWriteLock::LockWrite()
+{
+    InterlockedIncrement(&mnWritersWaiting);
+    AcquireSRWLockExclusive(reinterpret_cast<PSRWLOCK>(&mSRWLock));
+    InterlockedDecrement(&mnWritersWaiting);
+}
+
+bool cRZReadWriteLock::TryLockWrite()
+{
+    return TryAcquireSRWLockExclusive(reinterpret_cast<PSRWLOCK>(&mSRWLock)) != 0;
+}
+
+void cRZReadWriteLock::UnlockWrite()
+{
+    ReleaseSRWLockExclusive(reinterpret_cast<PSRWLOCK>(&mSRWLock));
+}
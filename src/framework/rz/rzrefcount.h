@@ -0,0 +1,70 @@
+/**
+ * @file
+ *
+ * @brief Reference count that can be shared between threads.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+
+#include "rzthreadsafe.h"
+#include <stdint.h>
+
+/**
+ * @brief Atomic reference count for objects implementing cIGZUnknown.
+ *
+ * Held as a member in place of a plain integer count so classes keep their ABI layout. Adding a reference only needs
+ * the count to be atomic, removing one also orders the object's earlier writes before whichever thread deletes it.
+ * Copies start from zero as the count belongs to the object, not its value.
+ */
+class cRZRefCountMT
+{
+public:
+    cRZRefCountMT(uint32_t count = 0) : mnCount(count) {}
+    cRZRefCountMT(const cRZRefCountMT &) : mnCount(0) {}
+    cRZRefCountMT &operator=(const cRZRefCountMT &) { return *this; }
+
+    /**
+     * @return The new reference count.
+     */
+    uint32_t AddRef() { return mnCount.FetchAdd(1, kRZMemoryOrderRelaxed) + 1; }
+    /**
+     * @brief Removes a reference, wrapping if there were none, so callers decide when to delete.
+     * @return The new reference count.
+     */
+    uint32_t Release() { return mnCount.FetchSub(1, kRZMemoryOrderAcqRel) - 1; }
+    /**
+     * @brief Removes a reference treating the count as signed, so releasing an object nothing referenced still reports
+     * it as unreferenced for classes that delete themselves at that point.
+     * @return The new reference count, or zero if no references remain.
+     */
+    uint32_t ReleaseSigned()
+    {
+        int32_t count = int32_t(Release());
+        return count > 0 ? uint32_t(count) : 0;
+    }
+    /**
+     * @brief Removes a reference unless there are none left.
+     * @return The new reference count.
+     */
+    uint32_t RemoveRef()
+    {
+        uint32_t count = mnCount.Load(kRZMemoryOrderRelaxed);
+
+        while (count != 0 && !mnCount.CompareExchangeWeak(count, count - 1, kRZMemoryOrderAcqRel)) {
+        }
+
+        return count != 0 ? count - 1 : 0;
+    }
+    uint32_t Count() const { return mnCount.Load(kRZMemoryOrderAcquire); }
+
+private:
+    cRZAtomic<uint32_t> mnCount;
+};
+
+static_assert(sizeof(cRZRefCountMT) == sizeof(uint32_t), "cRZRefCountMT must replace a plain count without changing layout");
@@ -0,0 +1,88 @@
+/**
+ * @file
+ *
+ * @brief Linear arena for short lived allocations that are released all at once.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzscopedarena.h"
+
+cRZScopedArena::cRZScopedArena(size_t nBlockSize) :
+    mpBlocks(nullptr),
+    mpCur(nullptr),
+    mpEnd(nullptr),
+    mpBuffer(nullptr),
+    mnBufferSize(0),
+    mnBlockSize(nBlockSize),
+    mnBytesAllocated(0)
+{
+    // Empty
+}
+
+cRZScopedArena::cRZScopedArena(void *pBuffer, size_t nBufferSize, size_t nBlockSize) :
+    mpBlocks(nullptr),
+    mpCur(static_cast<char *>(pBuffer)),
+    mpEnd(static_cast<char *>(pBuffer) + nBufferSize),
+    mpBuffer(static_cast<char *>(pBuffer)),
+    mnBufferSize(nBufferSize),
+    mnBlockSize(nBlockSize),
+    mnBytesAllocated(0)
+{
+    // Empty
+}
+
+cRZScopedArena::~cRZScopedArena()
+{
+    Reset();
+}
+
+void cRZScopedArena::Reset()
+{
+    while (mpBlocks != nullptr) {
+        Block *next = mpBlocks->mpNext;
+        RZFastFreeSized(mpBlocks, mpBlocks->mnSize);
+        mpBlocks = next;
+    }
+
+    mpCur = mpBuffer;
+    mpEnd = mpBuffer != nullptr ? mpBuffer + mnBufferSize : nullptr;
+    mnBytesAllocated = 0;
+}
+
+void *cRZScopedArena::AllocateSlow(size_t nCount, size_t nAlign)
+{
+    if (nCount > SIZE_MAX - sizeof(Block) - nAlign) {
+        return nullptr;
+    }
+
+    size_t needed = sizeof(Block) + nAlign - 1 + nCount;
+
+    // Requests that would waste most of a standard block get one to themselves and leave the current block in use.
+    bool dedicated = needed > mnBlockSize / 2;
+    size_t size = dedicated ? needed : mnBlockSize;
+    Block *block = static_cast<Block *>(RZFastAlloc(size));
+
+    if (block == nullptr) {
+        return nullptr;
+    }
+
+    block->mpNext = mpBlocks;
+    block->mnSize = size;
+    mpBlocks = block;
+
+    uintptr_t data = uintptr_t(block + 1);
+    char *aligned = reinterpret_cast<char *>((data + nAlign - 1) & ~uintptr_t(nAlign - 1));
+    mnBytesAllocated += nCount;
+
+    if (!dedicated) {
+        mpCur = aligned + nCount;
+        mpEnd = reinterpret_cast<char *>(block) + size;
+    }
+
+    return aligned;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file
+ *
+ * @brief Linear arena for short lived allocations that are released all at once.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+
+#include "rzfastalloc.h"
+#include <stdint.h>
+#include <string>
+
+/**
+ * @brief Bump allocator that releases everything it handed out when reset or destroyed.
+ *
+ * Memory is carved from an optional caller supplied buffer first, usually on the stack, then from blocks obtained
+ * through RZFastAlloc. Individual frees only reclaim the most recent allocation.
+ */
+class cRZScopedArena
+{
+public:
+    enum
+    {
+        kDefaultBlockSize = 16384,
+        kDefaultAlign = 16,
+    };
+
+public:
+    explicit cRZScopedArena(size_t nBlockSize = kDefaultBlockSize);
+    cRZScopedArena(void *pBuffer, size_t nBufferSize, size_t nBlockSize = kDefaultBlockSize);
+    ~cRZScopedArena();
+
+    /**
+     * @brief Allocates memory that stays valid until the arena is reset or destroyed.
+     * @param nAlign Alignment of the returned memory, must be a power of two.
+     */
+    void *Allocate(size_t nCount, size_t nAlign = kDefaultAlign)
+    {
+        uintptr_t cur = uintptr_t(mpCur);
+        uintptr_t aligned = (cur + nAlign - 1) & ~uintptr_t(nAlign - 1);
+
+        // Compared against the space left rather than adding to nCount so huge requests can't wrap around.
+        if (mpCur == nullptr || aligned > uintptr_t(mpEnd) || nCount > size_t(uintptr_t(mpEnd) - aligned)) {
+            return AllocateSlow(nCount, nAlign);
+        }
+
+        mpCur = reinterpret_cast<char *>(aligned + nCount);
+        mnBytesAllocated += nCount;
+
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    /**
+     * @brief Gives memory back if it was the most recent allocation, otherwise it waits for the next reset.
+     */
+    void Free(void *pvMem, size_t nCount)
+    {
+        if (pvMem != nullptr && static_cast<char *>(pvMem) + nCount == mpCur) {
+            mpCur = static_cast<char *>(pvMem);
+            mnBytesAllocated -= nCount;
+        }
+    }
+
+    /**
+     * @brief Releases every allocation and any blocks obtained from the heap, keeping only the caller's buffer.
+     */
+    void Reset();
+
+    size_t BytesAllocated() const { return mnBytesAllocated; }
+
+private:
+    struct Block
+    {
+        Block *mpNext;
+        size_t mnSize;
+    };
+
+    cRZScopedArena(const cRZScopedArena &);
+    cRZScopedArena &operator=(const cRZScopedArena &);
+
+    void *AllocateSlow(size_t nCount, size_t nAlign);
+
+private:
+    Block *mpBlocks;
+    char *mpCur;
+    char *mpEnd;
+    char *mpBuffer;
+    size_t mnBufferSize;
+    size_t mnBlockSize;
+    size_t mnBytesAllocated;
+};
+
+/**
+ * @brief A STL allocator that takes its memory from a cRZScopedArena
+ *
+ * Containers using this allocator don't release their storage until the arena is reset, which makes building up
+ * scratch containers cheap. Without an arena it behaves as a cRZFastSTLAllocator.
+ */
+template<typename T> class cRZArenaAllocator
+{
+public:
+    typedef T value_type;
+    typedef T *pointer;
+    typedef const T *const_pointer;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+    typedef std::false_type is_always_equal;
+
+    template<class U> struct rebind
+    {
+        typedef cRZArenaAllocator<U> other;
+    };
+
+public:
+    cRZArenaAllocator() : mpArena(nullptr) {}
+    cRZArenaAllocator(cRZScopedArena *pArena) : mpArena(pArena) {}
+    cRZArenaAllocator(const cRZArenaAllocator &other) : mpArena(other.mpArena) {}
+    template<class U> cRZArenaAllocator(const cRZArenaAllocator<U> &other) : mpArena(other.Arena()) {}
+
+    pointer allocate(size_type nCount)
+    {
+        if (mpArena == nullptr) {
+            return cRZFastSTLAllocator<T>().allocate(nCount);
+        }
+
+        return static_cast<pointer>(mpArena->Allocate(sizeof(T) * nCount, alignof(T)));
+    }
+
+    void deallocate(pointer pElem, size_type nCount)
+    {
+        if (mpArena == nullptr) {
+            cRZFastSTLAllocator<T>().deallocate(pElem, nCount);
+        } else {
+            mpArena->Free(pElem, sizeof(T) * nCount);
+        }
+    }
+#ifdef MATCH_ABI
+    // STLPort predates std::allocator_traits and calls these directly.
+    void construct(pointer pElem, const_reference sValue) { new (pElem) T(sValue); }
+    void destroy(pointer pElem) { pElem->~T(); }
+
+    pointer address(reference sValue) { return &sValue; }
+    const_pointer address(const_reference sValue) const { return &sValue; }
+#endif
+
+    cRZArenaAllocator<T> &operator=(const cRZArenaAllocator &other)
+    {
+        mpArena = other.mpArena;
+        return *this;
+    }
+
+    size_type max_size() const { return size_t(-1) / sizeof(T); }
+    cRZScopedArena *Arena() const { return mpArena; }
+
+private:
+    cRZScopedArena *mpArena;
+};
+
+template<typename T, typename U> bool operator==(const cRZArenaAllocator<T> &left, const cRZArenaAllocator<U> &right)
+{
+    return left.Arena() == right.Arena();
+}
+
+template<typename T, typename U> bool operator!=(const cRZArenaAllocator<T> &left, const cRZArenaAllocator<U> &right)
+{
+    return left.Arena() != right.Arena();
+}
+
+typedef std::basic_string<char, std::char_traits<char>, cRZArenaAllocator<char>> cRZArenaString;
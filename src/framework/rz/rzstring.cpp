@@ -11,9 +11,10 @@
  *            LICENSE
  */
 #include "rzstring.h"
+#include "rzcasefold.h"
 #include <algorithm>
+#include <cstdio>
 #include <cstring>
-#include <strings.h>
 
 #ifdef DLL_BUILD
 // Ensure object is correct size for ABI compatibility.
@@ -56,19 +57,19 @@ bool cRZString::QueryInterface(uint32_t riid, void **ppvObj)
 
 uint32_t cRZString::AddRef()
 {
-    return ++mnRefCount;
+    return mnRefCount.AddRef();
 }
 
 uint32_t cRZString::Release()
 {
-    --mnRefCount;
+    uint32_t count = mnRefCount.Release();
 
-    if (mnRefCount <= 0) {
+    if (count == 0) {
         delete this;
         return 0;
     }
 
-    return mnRefCount;
+    return count;
 }
 
 void cRZString::FromChar(const char *pszSource)
@@ -115,14 +116,12 @@ bool cRZString::IsEqual(const cIGZString *szOther, bool bCaseSensitive) const
         return Strlen() == 0;
     }
 
-    cRZString tmp(szOther->ToChar());
-
-    return CompareTo(tmp, bCaseSensitive) == 0;
+    return IsEqual(szOther->Data(), szOther->Strlen(), bCaseSensitive);
 }
 
 bool cRZString::IsEqual(const cIGZString &szOther, bool bCaseSensitive) const
 {
-    return CompareTo(szOther, bCaseSensitive) == 0;
+    return IsEqual(szOther.Data(), szOther.Strlen(), bCaseSensitive);
 }
 
 bool cRZString::IsEqual(const char *pszOther, bool bCaseSensitive) const
@@ -131,7 +130,7 @@ bool cRZString::IsEqual(const char *pszOther, bool bCaseSensitive) const
         return Strlen() == 0;
     }
 
-    return CompareTo(pszOther, strlen(pszOther), bCaseSensitive) == 0;
+    return IsEqual(pszOther, strlen(pszOther), bCaseSensitive);
 }
 
 bool cRZString::IsEqual(const char *pszOther, uint32_t dwLength, bool bCaseSensitive) const
@@ -140,27 +139,25 @@ bool cRZString::IsEqual(const char *pszOther, uint32_t dwLength, bool bCaseSensi
         return Strlen() == 0;
     }
 
-    return CompareTo(pszOther, dwLength, bCaseSensitive) == 0;
-}
-
-int32_t cRZString::CompareTo(const cIGZString &szOther, bool bCaseSensitive) const
-{
-    uint32_t other_len = szOther.Strlen();
-    uint32_t cmp_len = std::min((uint32_t)size(), other_len);
-
-    int32_t ret;
+    if (dwLength == -1) {
+        dwLength = strlen(pszOther);
+    }
 
-    if (bCaseSensitive) {
-        ret = std::strncmp(c_str(), szOther.ToChar(), cmp_len);
-    } else {
-        ret = strncasecmp(c_str(), szOther.ToChar(), cmp_len);
+    // Strings of different lengths can never compare equal so there is no need to look at the contents.
+    if (dwLength != size()) {
+        return false;
     }
 
-    if (ret == 0) {
-        ret = size() - other_len;
+    if (!bCaseSensitive) {
+        return RZCaseEqual(data(), size(), pszOther, dwLength);
     }
 
-    return ret;
+    return CompareTo(pszOther, dwLength, bCaseSensitive) == 0;
+}
+
+int32_t cRZString::CompareTo(const cIGZString &szOther, bool bCaseSensitive) const
+{
+    return CompareTo(szOther.Data(), szOther.Strlen(), bCaseSensitive);
 }
 
 int32_t cRZString::CompareTo(const char *pszOther, bool bCaseSensitive) const
@@ -174,15 +171,13 @@ int32_t cRZString::CompareTo(const char *pszOther, uint32_t dwLength, bool bCase
         dwLength = strlen(pszOther);
     }
 
-    uint32_t cmp_len = std::min((uint32_t)size(), dwLength);
-    int32_t ret;
-
-    if (bCaseSensitive) {
-        ret = std::strncmp(c_str(), pszOther, cmp_len);
-    } else {
-        ret = strncasecmp(c_str(), pszOther, cmp_len);
+    if (!bCaseSensitive) {
+        return RZCaseCompare(data(), size(), pszOther, dwLength);
     }
 
+    uint32_t cmp_len = std::min((uint32_t)size(), dwLength);
+    int32_t ret = std::strncmp(c_str(), pszOther, cmp_len);
+
     if (ret == 0) {
         ret = size() - dwLength;
     }
@@ -271,12 +266,7 @@ int32_t cRZString::Find(const char *pszOther, uint32_t dwPos, bool bCaseSensitiv
         return find(pszOther, dwPos);
     }
 
-    cRZString tmpthis(*this);
-    cRZString tmpother(pszOther, strlen(pszOther));
-    tmpthis.MakeLower();
-    tmpother.MakeLower();
-
-    return tmpthis.find(tmpother, dwPos);
+    return RZCaseFind(data(), size(), pszOther, strlen(pszOther), dwPos);
 }
 
 int32_t cRZString::Find(const cIGZString &szOther, uint32_t dwPos, bool bCaseSensitive) const
@@ -285,12 +275,7 @@ int32_t cRZString::Find(const cIGZString &szOther, uint32_t dwPos, bool bCaseSen
         return find(szOther.ToChar(), dwPos);
     }
 
-    cRZString tmpthis(*this);
-    cRZString tmpother(szOther);
-    tmpthis.MakeLower();
-    tmpother.MakeLower();
-
-    return tmpthis.find(tmpother, dwPos);
+    return RZCaseFind(data(), size(), szOther.Data(), szOther.Strlen(), dwPos);
 }
 
 int32_t cRZString::RFind(const char *pszOther, uint32_t dwPos, bool bCaseSensitive) const
@@ -299,12 +284,7 @@ int32_t cRZString::RFind(const char *pszOther, uint32_t dwPos, bool bCaseSensiti
         return rfind(pszOther, dwPos);
     }
 
-    cRZString tmpthis(*this);
-    cRZString tmpother(pszOther, strlen(pszOther));
-    tmpthis.MakeLower();
-    tmpother.MakeLower();
-
-    return tmpthis.rfind(tmpother, dwPos);
+    return RZCaseRFind(data(), size(), pszOther, strlen(pszOther), dwPos);
 }
 
 int32_t cRZString::RFind(const cIGZString &szOther, uint32_t dwPos, bool bCaseSensitive) const
@@ -313,12 +293,7 @@ int32_t cRZString::RFind(const cIGZString &szOther, uint32_t dwPos, bool bCaseSe
         return rfind(szOther.ToChar(), dwPos);
     }
 
-    cRZString tmpthis(*this);
-    cRZString tmpother(szOther);
-    tmpthis.MakeLower();
-    tmpother.MakeLower();
-
-    return tmpthis.rfind(tmpother, dwPos);
+    return RZCaseRFind(data(), size(), szOther.Data(), szOther.Strlen(), dwPos);
 }
 
 cIGZString *cRZString::Sprintf(const char *pszFormat, ...)
@@ -333,32 +308,21 @@ cIGZString *cRZString::Sprintf(const char *pszFormat, ...)
 
 cIGZString *cRZString::SprintfVaList(const char *pszFormat, va_list zList)
 {
+    // The first pass both measures and usually formats the whole string, vsnprintf consumes the list so it gets a copy.
     char buffer[256];
-    int len = std::vsnprintf(buffer, sizeof(buffer), pszFormat, zList);
-
-    if (len < 256) {
-        // If we got a positive length in the range of the preallocated buffer we are done.
-        // Otherwise start allocating increasingly large buffers until we get a valid return.
-        if (len > 0) {
-            assign(buffer);
-        } else {
-            size_t tmp_len = std::max(2 * sizeof(pszFormat), 2 * size());
-
-            while (tmp_len <= 999999 && len < 0) {
-                resize(len + 1);
-                len = std::vsnprintf(&operator[](0), tmp_len, pszFormat, zList);
-                tmp_len *= 2;
-            }
-
-            if (len > 0) {
-                resize(len);
-            }
-        }
+    va_list args;
+    va_copy(args, zList);
+    int len = std::vsnprintf(buffer, sizeof(buffer), pszFormat, args);
+    va_end(args);
+
+    if (len < 0) {
+        erase();
+    } else if (len < int(sizeof(buffer))) {
+        assign(buffer, len);
     } else {
-        // If we got a positive length greater than the buffer allocate a temporary buffer of appropriate size.
-        resize(len + 1);
-        len = std::vsnprintf(&operator[](0), len + 1, pszFormat, zList);
+        // Too long for the stack buffer but now we know the exact size, so format straight into the string.
         resize(len);
+        std::vsnprintf(&operator[](0), len + 1, pszFormat, zList);
     }
 
     return this;
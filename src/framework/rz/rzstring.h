@@ -13,7 +13,9 @@
 #pragma once
 #include "igzstring.h"
 #include "rzfastalloc.h"
+#include "rzrefcount.h"
 #include <string>
+#include <utility>
 
 /**
  * @brief An implementation of cIGZString based around std::string
@@ -35,6 +37,13 @@ public:
     cRZString(const char *pszSource, size_t dwLen);
     cRZString(const cIGZString &szSource);
     cRZString(char cChar, size_t dwRepetitions);
+#ifndef MATCH_ABI
+    cRZString(string_data &&szSource) noexcept : string_data(std::move(szSource)), mnRefCount(0) {}
+    cRZString(cRZString &&szSource) noexcept :
+        string_data(std::move(static_cast<string_data &>(szSource))), mnRefCount(0)
+    {
+    }
+#endif
 
     virtual ~cRZString() {}
 
@@ -104,7 +113,18 @@ public:
 
         return *this;
     }
+#ifndef MATCH_ABI
+    // Only the characters move, the reference count belongs to the object.
+    cRZString &operator=(cRZString &&that) noexcept
+    {
+        if (this != &that) {
+            static_cast<string_data &>(*this) = std::move(static_cast<string_data &>(that));
+        }
+
+        return *this;
+    }
+#endif
 
 private:
-    uint32_t mnRefCount;
+    cRZRefCountMT mnRefCount;
 };
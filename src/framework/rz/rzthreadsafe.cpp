@@ -25,8 +25,8 @@ void *RZThreadSafeExchange(void *volatile &val, void *xchg)
 #else
 #pragma message "Falling back to unsafe exchange, implement compiler intrinsics for thread safe exchange here."
     void *tmp = val;
-    *val = xchg;
-    return val;
+    val = xchg;
+    return tmp;
 #endif
 }
 
@@ -13,6 +13,12 @@
 #pragma once
 #include <stdint.h>
 
+#ifndef MATCH_ABI
+#include <atomic>
+#elif defined _MSC_VER && !defined __clang__
+#include <intrin.h>
+#endif
+
 /**
  * @brief Performs a thread safe exchange of two values.
  * @param val Reference to the value to be exchanged.
@@ -27,3 +33,299 @@ void *RZThreadSafeExchange(void *volatile &val, void *xchg);
  * @return New value of val.
  */
 uint32_t RZThreadSafeAdd(volatile uint32_t &val, uint32_t inc);
+
+/**
+ * @brief Ordering constraints for cRZAtomic operations, matching the C++ memory orders of the same names.
+ */
+enum RZMemoryOrder
+{
+    kRZMemoryOrderRelaxed,
+    kRZMemoryOrderAcquire,
+    kRZMemoryOrderRelease,
+    kRZMemoryOrderAcqRel,
+    kRZMemoryOrderSeqCst,
+};
+
+/**
+ * @brief Atomic integer or pointer with explicit memory ordering for each operation.
+ *
+ * Standalone builds wrap std::atomic. ABI builds have no std::atomic available from STLport so they use compiler
+ * intrinsics instead and are limited to types the size of a long, which covers integers and pointers on 32bit x86.
+ * Fetch operations other than exchange are only available for integer types.
+ */
+template<typename T> class cRZAtomic
+{
+public:
+    cRZAtomic() : mValue() {}
+    cRZAtomic(T value) : mValue(value) {}
+
+    T Load(RZMemoryOrder order = kRZMemoryOrderSeqCst) const;
+    void Store(T value, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+    /**
+     * @return Value held before the exchange.
+     */
+    T Exchange(T value, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+    /**
+     * @brief Replaces the value with desired if it currently equals expected.
+     * @param expected Value to compare against, updated to the current value if the exchange fails.
+     * @param desired Value to store if the comparison succeeds.
+     * @param order Ordering on success, failure uses the strongest ordering valid for a load.
+     * @return If the value was replaced.
+     */
+    bool CompareExchange(T &expected, T desired, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+    /**
+     * @brief As CompareExchange but may fail spuriously, which can be cheaper when called in a loop.
+     */
+    bool CompareExchangeWeak(T &expected, T desired, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+
+    /**
+     * @return Value held before the operation.
+     */
+    T FetchAdd(T value, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+    T FetchSub(T value, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+    T FetchOr(T value, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+    T FetchAnd(T value, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+    T FetchXor(T value, RZMemoryOrder order = kRZMemoryOrderSeqCst);
+
+private:
+    cRZAtomic(const cRZAtomic &) = delete;
+    cRZAtomic &operator=(const cRZAtomic &) = delete;
+
+private:
+#ifndef MATCH_ABI
+    std::atomic<T> mValue;
+#else
+    volatile T mValue;
+#endif
+};
+
+#ifndef MATCH_ABI
+namespace RZAtomicDetail
+{
+inline std::memory_order ToStd(RZMemoryOrder order)
+{
+    static const std::memory_order orders[] = { std::memory_order_relaxed,
+        std::memory_order_acquire,
+        std::memory_order_release,
+        std::memory_order_acq_rel,
+        std::memory_order_seq_cst };
+    return orders[order];
+}
+} // namespace RZAtomicDetail
+
+template<typename T> inline T cRZAtomic<T>::Load(RZMemoryOrder order) const
+{
+    return mValue.load(RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline void cRZAtomic<T>::Store(T value, RZMemoryOrder order)
+{
+    mValue.store(value, RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::Exchange(T value, RZMemoryOrder order)
+{
+    return mValue.exchange(value, RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline bool cRZAtomic<T>::CompareExchange(T &expected, T desired, RZMemoryOrder order)
+{
+    return mValue.compare_exchange_strong(expected, desired, RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline bool cRZAtomic<T>::CompareExchangeWeak(T &expected, T desired, RZMemoryOrder order)
+{
+    return mValue.compare_exchange_weak(expected, desired, RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchAdd(T value, RZMemoryOrder order)
+{
+    return mValue.fetch_add(value, RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchSub(T value, RZMemoryOrder order)
+{
+    return mValue.fetch_sub(value, RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchOr(T value, RZMemoryOrder order)
+{
+    return mValue.fetch_or(value, RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchAnd(T value, RZMemoryOrder order)
+{
+    return mValue.fetch_and(value, RZAtomicDetail::ToStd(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchXor(T value, RZMemoryOrder order)
+{
+    return mValue.fetch_xor(value, RZAtomicDetail::ToStd(order));
+}
+#elif defined __GNUC__ || defined __clang__
+namespace RZAtomicDetail
+{
+inline int ToBuiltin(RZMemoryOrder order)
+{
+    static const int orders[] = { __ATOMIC_RELAXED, __ATOMIC_ACQUIRE, __ATOMIC_RELEASE, __ATOMIC_ACQ_REL, __ATOMIC_SEQ_CST };
+    return orders[order];
+}
+
+// A failed compare exchange only loads so it cannot have release semantics.
+inline int ToBuiltinFailure(RZMemoryOrder order)
+{
+    static const int orders[] = { __ATOMIC_RELAXED, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED, __ATOMIC_ACQUIRE, __ATOMIC_SEQ_CST };
+    return orders[order];
+}
+} // namespace RZAtomicDetail
+
+template<typename T> inline T cRZAtomic<T>::Load(RZMemoryOrder order) const
+{
+    return __atomic_load_n(&mValue, RZAtomicDetail::ToBuiltin(order));
+}
+
+template<typename T> inline void cRZAtomic<T>::Store(T value, RZMemoryOrder order)
+{
+    __atomic_store_n(&mValue, value, RZAtomicDetail::ToBuiltin(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::Exchange(T value, RZMemoryOrder order)
+{
+    return __atomic_exchange_n(&mValue, value, RZAtomicDetail::ToBuiltin(order));
+}
+
+template<typename T> inline bool cRZAtomic<T>::CompareExchange(T &expected, T desired, RZMemoryOrder order)
+{
+    return __atomic_compare_exchange_n(
+        &mValue, &expected, desired, false, RZAtomicDetail::ToBuiltin(order), RZAtomicDetail::ToBuiltinFailure(order));
+}
+
+template<typename T> inline bool cRZAtomic<T>::CompareExchangeWeak(T &expected, T desired, RZMemoryOrder order)
+{
+    return __atomic_compare_exchange_n(
+        &mValue, &expected, desired, true, RZAtomicDetail::ToBuiltin(order), RZAtomicDetail::ToBuiltinFailure(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchAdd(T value, RZMemoryOrder order)
+{
+    return __atomic_fetch_add(&mValue, value, RZAtomicDetail::ToBuiltin(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchSub(T value, RZMemoryOrder order)
+{
+    return __atomic_fetch_sub(&mValue, value, RZAtomicDetail::ToBuiltin(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchOr(T value, RZMemoryOrder order)
+{
+    return __atomic_fetch_or(&mValue, value, RZAtomicDetail::ToBuiltin(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchAnd(T value, RZMemoryOrder order)
+{
+    return __atomic_fetch_and(&mValue, value, RZAtomicDetail::ToBuiltin(order));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchXor(T value, RZMemoryOrder order)
+{
+    return __atomic_fetch_xor(&mValue, value, RZAtomicDetail::ToBuiltin(order));
+}
+#elif defined _MSC_VER
+// Interlocked operations are full barriers on x86 and aligned volatile accesses already have acquire and release
+// semantics under MSVC, so only sequentially consistent stores need anything stronger than a compiler barrier.
+namespace RZAtomicDetail
+{
+template<typename T> inline long ToLong(T value)
+{
+    static_assert(sizeof(T) == sizeof(long), "ABI builds only support atomics the size of a long.");
+    union
+    {
+        T value;
+        long raw;
+    } convert;
+    convert.value = value;
+    return convert.raw;
+}
+
+template<typename T> inline T FromLong(long raw)
+{
+    union
+    {
+        T value;
+        long raw;
+    } convert;
+    convert.raw = raw;
+    return convert.value;
+}
+} // namespace RZAtomicDetail
+
+template<typename T> inline T cRZAtomic<T>::Load(RZMemoryOrder) const
+{
+    T value = mValue;
+    _ReadWriteBarrier();
+    return value;
+}
+
+template<typename T> inline void cRZAtomic<T>::Store(T value, RZMemoryOrder order)
+{
+    if (order == kRZMemoryOrderSeqCst) {
+        Exchange(value, order);
+    } else {
+        _ReadWriteBarrier();
+        mValue = value;
+    }
+}
+
+template<typename T> inline T cRZAtomic<T>::Exchange(T value, RZMemoryOrder)
+{
+    return RZAtomicDetail::FromLong<T>(
+        _InterlockedExchange(reinterpret_cast<volatile long *>(&mValue), RZAtomicDetail::ToLong(value)));
+}
+
+template<typename T> inline bool cRZAtomic<T>::CompareExchange(T &expected, T desired, RZMemoryOrder)
+{
+    long comparand = RZAtomicDetail::ToLong(expected);
+    long previous = _InterlockedCompareExchange(
+        reinterpret_cast<volatile long *>(&mValue), RZAtomicDetail::ToLong(desired), comparand);
+
+    if (previous == comparand) {
+        return true;
+    }
+
+    expected = RZAtomicDetail::FromLong<T>(previous);
+
+    return false;
+}
+
+template<typename T> inline bool cRZAtomic<T>::CompareExchangeWeak(T &expected, T desired, RZMemoryOrder order)
+{
+    return CompareExchange(expected, desired, order);
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchAdd(T value, RZMemoryOrder)
+{
+    return T(_InterlockedExchangeAdd(reinterpret_cast<volatile long *>(&mValue), long(value)));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchSub(T value, RZMemoryOrder)
+{
+    return T(_InterlockedExchangeAdd(reinterpret_cast<volatile long *>(&mValue), -long(value)));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchOr(T value, RZMemoryOrder)
+{
+    return T(_InterlockedOr(reinterpret_cast<volatile long *>(&mValue), long(value)));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchAnd(T value, RZMemoryOrder)
+{
+    return T(_InterlockedAnd(reinterpret_cast<volatile long *>(&mValue), long(value)));
+}
+
+template<typename T> inline T cRZAtomic<T>::FetchXor(T value, RZMemoryOrder)
+{
+    return T(_InterlockedXor(reinterpret_cast<volatile long *>(&mValue), long(value)));
+}
+#else
+#error "Implement cRZAtomic with compiler intrinsics for this compiler."
+#endif
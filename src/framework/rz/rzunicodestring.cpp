@@ -0,0 +1,355 @@
+/**
+ * @file
+ *
+ * @brief A UTF-16 string class with conversion to and from UTF-8.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "rzunicodestring.h"
+#include <algorithm>
+
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#define HAVE_SSE2_TRANSCODE 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+const unichar_t kReplacementChar = 0xFFFD;
+} // namespace
+
+size_t RZUTF8ToUTF16(unichar_t *pDest, const char *pszSource, size_t nLength)
+{
+    const unsigned char *src = reinterpret_cast<const unsigned char *>(pszSource);
+    const unsigned char *end = src + nLength;
+    unichar_t *dst = pDest;
+
+    while (src < end) {
+#ifdef HAVE_SSE2_TRANSCODE
+        // Runs of ASCII are widened 16 bytes at a time.
+        const __m128i zero = _mm_setzero_si128();
+
+        while (end - src >= 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+
+            if (_mm_movemask_epi8(bytes) != 0) {
+                break;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 8), _mm_unpackhi_epi8(bytes, zero));
+            src += 16;
+            dst += 16;
+        }
+
+        if (src == end) {
+            break;
+        }
+#endif
+        uint32_t c = *src++;
+
+        if (c < 0x80) {
+            *dst++ = unichar_t(c);
+            continue;
+        }
+
+        int extra;
+        uint32_t min;
+
+        if (c >= 0xC2 && c <= 0xDF) {
+            extra = 1;
+            min = 0x80;
+            c &= 0x1F;
+        } else if (c >= 0xE0 && c <= 0xEF) {
+            extra = 2;
+            min = 0x800;
+            c &= 0x0F;
+        } else if (c >= 0xF0 && c <= 0xF4) {
+            extra = 3;
+            min = 0x10000;
+            c &= 0x07;
+        } else {
+            *dst++ = kReplacementChar;
+            continue;
+        }
+
+        int i = 0;
+
+        for (; i < extra && src < end && (*src & 0xC0) == 0x80; ++i) {
+            c = (c << 6) | (*src++ & 0x3F);
+        }
+
+        // Truncated, overlong and surrogate encodings are all replaced, the bytes consumed so far are skipped.
+        if (i < extra || c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+            *dst++ = kReplacementChar;
+        } else if (c >= 0x10000) {
+            c -= 0x10000;
+            *dst++ = unichar_t(0xD800 + (c >> 10));
+            *dst++ = unichar_t(0xDC00 + (c & 0x3FF));
+        } else {
+            *dst++ = unichar_t(c);
+        }
+    }
+
+    return dst - pDest;
+}
+
+size_t RZUTF16ToUTF8(char *pDest, const unichar_t *pszSource, size_t nLength)
+{
+    const unichar_t *src = pszSource;
+    const unichar_t *end = src + nLength;
+    unsigned char *dst = reinterpret_cast<unsigned char *>(pDest);
+
+    while (src < end) {
+#ifdef HAVE_SSE2_TRANSCODE
+        // Runs of ASCII are narrowed 16 code units at a time.
+        const __m128i ascii_mask = _mm_set1_epi16(short(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+
+        while (end - src >= 16) {
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 8));
+            __m128i high_bits = _mm_and_si128(_mm_or_si128(lo, hi), ascii_mask);
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, zero)) != 0xFFFF) {
+                break;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(lo, hi));
+            src += 16;
+            dst += 16;
+        }
+
+        if (src == end) {
+            break;
+        }
+#endif
+        uint32_t c = *src++;
+
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            if (c <= 0xDBFF && src < end && *src >= 0xDC00 && *src <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (*src++ - 0xDC00);
+            } else {
+                c = kReplacementChar;
+            }
+        }
+
+        if (c < 0x80) {
+            *dst++ = (unsigned char)c;
+        } else if (c < 0x800) {
+            *dst++ = (unsigned char)(0xC0 | (c >> 6));
+            *dst++ = (unsigned char)(0x80 | (c & 0x3F));
+        } else if (c < 0x10000) {
+            *dst++ = (unsigned char)(0xE0 | (c >> 12));
+            *dst++ = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+            *dst++ = (unsigned char)(0x80 | (c & 0x3F));
+        } else {
+            *dst++ = (unsigned char)(0xF0 | (c >> 18));
+            *dst++ = (unsigned char)(0x80 | ((c >> 12) & 0x3F));
+            *dst++ = (unsigned char)(0x80 | ((c >> 6) & 0x3F));
+            *dst++ = (unsigned char)(0x80 | (c & 0x3F));
+        }
+    }
+
+    return dst - reinterpret_cast<unsigned char *>(pDest);
+}
+
+unichar_t RZUnicodeFoldCase(unichar_t c)
+{
+    uint32_t u = c;
+
+    if (u < 0x80) {
+        return unichar_t(u - 'A' < 26u ? u | 0x20 : u);
+    }
+
+    if (u < 0x100) {
+        if (u >= 0xC0 && u <= 0xDE && u != 0xD7) {
+            return unichar_t(u + 0x20);
+        }
+
+        return unichar_t(u == 0xB5 ? 0x3BC : u);
+    }
+
+    // Latin Extended-A mostly alternates upper and lower case pairs.
+    if (u < 0x180) {
+        if (u == 0x130) {
+            return 'i';
+        } else if (u == 0x178) {
+            return 0xFF;
+        } else if (u == 0x17F) {
+            return 's';
+        } else if ((u >= 0x100 && u <= 0x12F) || (u >= 0x132 && u <= 0x137) || (u >= 0x14A && u <= 0x177)) {
+            return unichar_t(u | 1);
+        } else if ((u >= 0x139 && u <= 0x148) || (u >= 0x179 && u <= 0x17E)) {
+            return unichar_t((u & 1) ? u + 1 : u);
+        }
+
+        return c;
+    }
+
+    if (u >= 0x370 && u < 0x400) {
+        if (u >= 0x391 && u <= 0x3AB && u != 0x3A2) {
+            return unichar_t(u + 0x20);
+        } else if (u == 0x386) {
+            return 0x3AC;
+        } else if (u >= 0x388 && u <= 0x38A) {
+            return unichar_t(u + 0x25);
+        } else if (u == 0x38C) {
+            return 0x3CC;
+        } else if (u == 0x38E || u == 0x38F) {
+            return unichar_t(u + 0x3F);
+        } else if (u == 0x3C2) {
+            return 0x3C3;
+        }
+
+        return c;
+    }
+
+    if (u >= 0x400 && u < 0x530) {
+        if (u < 0x410) {
+            return unichar_t(u + 0x50);
+        } else if (u < 0x430) {
+            return unichar_t(u + 0x20);
+        } else if ((u >= 0x460 && u <= 0x481) || (u >= 0x48A && u <= 0x4BF) || (u >= 0x4D0 && u <= 0x52F)) {
+            return unichar_t(u | 1);
+        } else if (u == 0x4C0) {
+            return 0x4CF;
+        } else if (u >= 0x4C1 && u <= 0x4CE) {
+            return unichar_t((u & 1) ? u + 1 : u);
+        }
+
+        return c;
+    }
+
+    if (u >= 0xFF21 && u <= 0xFF3A) {
+        return unichar_t(u + 0x20);
+    }
+
+    return c;
+}
+
+unichar_t RZUnicodeToLower(unichar_t c)
+{
+    // Folding maps these lower case letters onto the letter they compare equal to.
+    switch (c) {
+        case 0xB5:
+        case 0x17F:
+        case 0x3C2:
+            return c;
+        default:
+            return RZUnicodeFoldCase(c);
+    }
+}
+
+int32_t RZUnicodeCaseCompare(const unichar_t *pszLeft, size_t nLeftLen, const unichar_t *pszRight, size_t nRightLen)
+{
+    size_t len = std::min(nLeftLen, nRightLen);
+
+    for (size_t i = 0; i < len; ++i) {
+        if (pszLeft[i] != pszRight[i]) {
+            int32_t diff = int32_t(RZUnicodeFoldCase(pszLeft[i])) - int32_t(RZUnicodeFoldCase(pszRight[i]));
+
+            if (diff != 0) {
+                return diff;
+            }
+        }
+    }
+
+    return int32_t(nLeftLen - nRightLen);
+}
+
+void cRZUnicodeString::FromUTF8(const char *pszSource, size_t dwLength)
+{
+    // UTF-16 never needs more code units than the UTF-8 has bytes.
+    resize(dwLength);
+    resize(RZUTF8ToUTF16(&operator[](0), pszSource, dwLength));
+}
+
+void cRZUnicodeString::ToUTF8(cRZString &szDest) const
+{
+    szDest.resize(size() * 3);
+    szDest.resize(RZUTF16ToUTF8(&szDest[0], data(), size()));
+}
+
+int32_t cRZUnicodeString::CompareTo(const unichar_t *pszOther, size_t dwLength, bool bCaseSensitive) const
+{
+    if (!bCaseSensitive) {
+        return RZUnicodeCaseCompare(data(), size(), pszOther, dwLength);
+    }
+
+    size_t len = std::min(size(), dwLength);
+
+    for (size_t i = 0; i < len; ++i) {
+        if ((*this)[i] != pszOther[i]) {
+            return int32_t((*this)[i]) - int32_t(pszOther[i]);
+        }
+    }
+
+    return int32_t(size() - dwLength);
+}
+
+void cRZUnicodeString::MakeLower()
+{
+    std::transform(begin(), end(), begin(), RZUnicodeToLower);
+}
+
+#if !defined BUILD_WITH_ICU && !defined _WIN32
+size_t u_strlen(const unichar_t *s)
+{
+    return std::char_traits<unichar_t>::length(s);
+}
+
+unichar_t *u_strcpy(unichar_t *dst, const unichar_t *src)
+{
+    return std::char_traits<unichar_t>::copy(dst, src, u_strlen(src) + 1);
+}
+
+unichar_t *u_strcat(unichar_t *dst, const unichar_t *src)
+{
+    u_strcpy(dst + u_strlen(dst), src);
+    return dst;
+}
+
+int32_t u_strcmp(const unichar_t *s1, const unichar_t *s2)
+{
+    for (; *s1 == *s2 && *s1 != 0; ++s1, ++s2) {
+    }
+
+    return int32_t(*s1) - int32_t(*s2);
+}
+
+int32_t u_strcasecmp(const unichar_t *s1, const unichar_t *s2, uint32_t)
+{
+    for (; RZUnicodeFoldCase(*s1) == RZUnicodeFoldCase(*s2) && *s1 != 0; ++s1, ++s2) {
+    }
+
+    return int32_t(RZUnicodeFoldCase(*s1)) - int32_t(RZUnicodeFoldCase(*s2));
+}
+
+bool u_isspace(unichar_t c)
+{
+    return c == ' ' || (c >= 0x09 && c <= 0x0D) || c == 0x85 || c == 0xA0 || c == 0x1680 || (c >= 0x2000 && c <= 0x200A)
+        || c == 0x2028 || c == 0x2029 || c == 0x202F || c == 0x205F || c == 0x3000;
+}
+
+unichar_t u_tolower(unichar_t c)
+{
+    return RZUnicodeToLower(c);
+}
+
+unichar_t *u_strchr(const unichar_t *s, unichar_t c)
+{
+    for (; *s != c; ++s) {
+        if (*s == 0) {
+            return nullptr;
+        }
+    }
+
+    return const_cast<unichar_t *>(s);
+}
+#endif
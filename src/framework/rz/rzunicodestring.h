@@ -0,0 +1,94 @@
+/**
+ * @file
+ *
+ * @brief A UTF-16 string class with conversion to and from UTF-8.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+#include "igzstring.h"
+#include "rzfastalloc.h"
+#include "rzstring.h"
+#include "unichar.h"
+#include <string>
+
+/**
+ * @brief Converts UTF-8 to UTF-16, malformed sequences become U+FFFD.
+ * @param pDest Buffer with room for at least nLength code units.
+ * @return Number of code units written.
+ */
+size_t RZUTF8ToUTF16(unichar_t *pDest, const char *pszSource, size_t nLength);
+/**
+ * @brief Converts UTF-16 to UTF-8, unpaired surrogates become U+FFFD.
+ * @param pDest Buffer with room for at least 3 * nLength bytes.
+ * @return Number of bytes written.
+ */
+size_t RZUTF16ToUTF8(char *pDest, const unichar_t *pszSource, size_t nLength);
+/**
+ * @brief Folds a code unit for case insensitive comparison.
+ *
+ * Covers the simple case mappings of Latin, Greek and Cyrillic scripts plus fullwidth Latin, which is what the games
+ * localisations use. Code units outside those ranges are returned as they are.
+ */
+unichar_t RZUnicodeFoldCase(unichar_t c);
+/**
+ * @brief Converts a code unit to lower case using the simple mappings of the same scripts RZUnicodeFoldCase covers.
+ *
+ * Unlike folding this leaves letters that are already lower case alone, such as final sigma and the micro sign.
+ */
+unichar_t RZUnicodeToLower(unichar_t c);
+/**
+ * @brief Compares two UTF-16 strings ignoring case.
+ * @return Difference of the first pair of folded code units that differ, otherwise the difference in length.
+ */
+int32_t RZUnicodeCaseCompare(const unichar_t *pszLeft, size_t nLeftLen, const unichar_t *pszRight, size_t nRightLen);
+
+/**
+ * @brief UTF-16 companion to cRZString
+ *
+ * Text is held as UTF-16 to match the games own unicode strings and can be converted to and from the UTF-8 held in
+ * cIGZString based objects in a single pass.
+ */
+class cRZUnicodeString : public std::basic_string<unichar_t, std::char_traits<unichar_t>, cRZFastSTLAllocator<unichar_t>>
+{
+    typedef std::basic_string<unichar_t, std::char_traits<unichar_t>, cRZFastSTLAllocator<unichar_t>> string_data;
+
+public:
+    cRZUnicodeString() {}
+    cRZUnicodeString(const string_data &szSource) : string_data(szSource) {}
+    cRZUnicodeString(const unichar_t *pszSource) : string_data(pszSource) {}
+    cRZUnicodeString(const unichar_t *pszSource, size_t dwLen) : string_data(pszSource, dwLen) {}
+    explicit cRZUnicodeString(const cIGZString &szSource) { FromUTF8(szSource.Data(), szSource.Strlen()); }
+
+    /**
+     * @brief Replaces the contents with UTF-8 text converted to UTF-16.
+     */
+    void FromUTF8(const char *pszSource, size_t dwLength);
+    /**
+     * @brief Converts the contents to UTF-8, replacing the contents of the destination.
+     */
+    void ToUTF8(cRZString &szDest) const;
+
+    int32_t CompareTo(const unichar_t *pszOther, size_t dwLength, bool bCaseSensitive) const;
+    int32_t CompareTo(const cRZUnicodeString &szOther, bool bCaseSensitive) const
+    {
+        return CompareTo(szOther.data(), szOther.size(), bCaseSensitive);
+    }
+
+    bool IsEqual(const unichar_t *pszOther, size_t dwLength, bool bCaseSensitive) const
+    {
+        return dwLength == size() && CompareTo(pszOther, dwLength, bCaseSensitive) == 0;
+    }
+
+    bool IsEqual(const cRZUnicodeString &szOther, bool bCaseSensitive) const
+    {
+        return IsEqual(szOther.data(), szOther.size(), bCaseSensitive);
+    }
+
+    void MakeLower();
+};
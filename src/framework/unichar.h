@@ -22,7 +22,9 @@ typedef UChar unichar_t;
 #include <wchar.h>
 typedef wchar_t unichar_t;
 #else
-#error Support for utf16<->utf8 conversion not found for this platform.
+#include <stddef.h>
+#include <stdint.h>
+typedef char16_t unichar_t;
 #endif
 
 // Alias the ICU unicode functions when not building against it.
@@ -37,6 +39,17 @@ typedef wchar_t unichar_t;
 #define u_tolower towlower
 #define u_strchr wcschr
 #define U_COMPARE_CODE_POINT_ORDER 0x8000
+#elif !defined BUILD_WITH_ICU
+// Without ICU or the win32 wide character functions the framework provides its own, see rzunicodestring.cpp.
+size_t u_strlen(const unichar_t *s);
+unichar_t *u_strcpy(unichar_t *dst, const unichar_t *src);
+unichar_t *u_strcat(unichar_t *dst, const unichar_t *src);
+int32_t u_strcmp(const unichar_t *s1, const unichar_t *s2);
+int32_t u_strcasecmp(const unichar_t *s1, const unichar_t *s2, uint32_t options);
+bool u_isspace(unichar_t c);
+unichar_t u_tolower(unichar_t c);
+unichar_t *u_strchr(const unichar_t *s, unichar_t c);
+#define U_COMPARE_CODE_POINT_ORDER 0x8000
 #endif
 
 #ifndef __has_attribute
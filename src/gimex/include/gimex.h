@@ -170,6 +170,16 @@ typedef struct GINFO
     int unused[3];
 } GINFO;
 
+/* Result of a header only scan, see GIMEX_scan */
+typedef struct GSCAN
+{
+    int signature;
+    int codec;
+    int width;
+    int height;
+    int bpp;
+} GSCAN;
+
 /*** "Standard" GIMEX libary functions. These should be defined by the application implementing GIMEX ***/
 
 /**
@@ -255,8 +265,21 @@ int GIMEX_API GIMEX_wclose(GINSTANCE *ctx);
  * @return Pointer to an GINFO struct. Caller must clean up with gfree.
  */
 GINFO *GIMEX_API GIMEX_info(GINSTANCE *ctx, int frame);
+/**
+ * @brief Retrieves only the dimensions of the graphics file without building a full GINFO.
+ * @param ctx Pointer to a GimexInstance context.
+ * @param width Pointer to an int to recieve the width in pixels, can be NULL.
+ * @param height Pointer to an int to recieve the height in pixels, can be NULL.
+ * @param bpp Pointer to an int to recieve the bits per pixel GIMEX_read will output, can be NULL.
+ * @return Were the dimensions retrieved successfully.
+ */
+bool GIMEX_API GIMEX_dims(GINSTANCE *ctx, int *width, int *height, int *bpp);
 /**
  * @brief Reads graphical data from a file.
+ *
+ * Setting info->bpp to 32 for an image that GIMEX_info reported as 8bpp paletted or grey scale makes the BMP, TGA
+ * and PNG codecs expand the pixels through colortbl to ARGB as they are read.
+ *
  * @param ctx Pointer to a GimexInstance context.
  * @param info Pointer to a GINFO struct.
  * @param buffer Pointer to a buffer to store the image data.
@@ -278,6 +301,11 @@ bool GIMEX_API GIMEX_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int
  * @return GABOUT struct filled with the infomation. Caller must free with gfree.
  */
 GABOUT *GIMEX_API GIMEX_about(void);
+/**
+ * @brief Retrieves the static information about the current GIMEX codec without allocating.
+ * @return Pointer to a constant GABOUT struct owned by the codec. Caller must not free it.
+ */
+const GABOUT *GIMEX_API GIMEX_aboutref(void);
 /**
  * @brief Sets the currently active codec index.
  * @param codec Index of the desired codec.
@@ -295,6 +323,17 @@ int GIMEX_API GIMEX_get(void);
  * @return Located GIMEX codex index.
  */
 int GIMEX_API GIMEX_find(const char *formats, int *format_index);
+/**
+ * @brief Identifies a stream and reads only the fixed header fields needed for its dimensions.
+ *
+ * Palettes, comments and other extension data are skipped. Unlike GIMEX_is and GIMEX_dims this doesn't use or change
+ * the current codec so it can be called from several threads at once as long as each uses its own stream.
+ *
+ * @param stream Stream to scan.
+ * @param scan Pointer to a GSCAN struct to recieve the codec signature, index and the image dimensions.
+ * @return Was a codec found that could read the dimensions.
+ */
+bool GIMEX_API GIMEX_scan(GSTREAM *stream, GSCAN *scan);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -0,0 +1,81 @@
+/**
+ * @file
+ *
+ * @brief Compact binary catalog of image dimensions built from GIMEX_scan results.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+
+#include <gimex.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GIMEX_INDEX_SIGNATURE GIMEX_ID('G', 'I', 'D', 'X')
+#define GIMEX_INDEX_VERSION 1
+
+/*
+ * On disk layout is a GINDEXHEADER, then count GINDEXENTRY records sorted by name and finally names_size bytes of nul
+ * terminated names. All fields are little endian and naturally aligned so a mapped file can be used in place.
+ */
+typedef struct GINDEXHEADER
+{
+    uint32_t signature;
+    uint32_t version;
+    uint32_t count;
+    uint32_t names_size;
+} GINDEXHEADER;
+
+typedef struct GINDEXENTRY
+{
+    uint32_t name_offset;
+    uint32_t signature;
+    uint32_t width;
+    uint32_t height;
+    uint16_t bpp;
+    uint16_t name_length;
+} GINDEXENTRY;
+
+/**
+ * @brief Writes a catalog index to a stream.
+ * @param stream Stream to write the index to.
+ * @param scans Array of scan results to store.
+ * @param names Array of names to store the scan results under, names are matched case sensitively.
+ * @param count Number of entries in the scans and names arrays.
+ * @return Was the index written successfully.
+ */
+bool GIMEX_API GIMEX_index_write(GSTREAM *stream, const GSCAN *scans, const char *const *names, int count);
+/**
+ * @brief Checks that a block of memory holds a complete catalog index.
+ * @param index Pointer to the start of the index, typically a mapped file.
+ * @param size Size of the index in bytes.
+ * @return Is the index valid.
+ */
+bool GIMEX_API GIMEX_index_valid(const void *index, size_t size);
+/**
+ * @brief Looks up a name in a catalog index that has been checked with GIMEX_index_valid.
+ * @param index Pointer to the start of the index.
+ * @param name Name to search for.
+ * @return Pointer to the matching entry inside the index, NULL if the name is not present.
+ */
+const GINDEXENTRY *GIMEX_API GIMEX_index_find(const void *index, const char *name);
+/**
+ * @brief Retrieves the name an entry in a catalog index is stored under.
+ * @param index Pointer to the start of the index.
+ * @param entry Pointer to an entry inside the index.
+ * @return Pointer to the nul terminated name inside the index.
+ */
+const char *GIMEX_API GIMEX_index_name(const void *index, const GINDEXENTRY *entry);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
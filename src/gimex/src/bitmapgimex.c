@@ -12,6 +12,7 @@
  */
 #include "bitmapgimex.h"
 #include "bitmap.h"
+#include "gpixel.h"
 #include <endianness.h>
 #include <stddef.h>
 #include <string.h>
@@ -48,6 +49,170 @@ static unsigned BMP_maskoffset(uint32_t mask)
     return count;
 }
 
+/* Lookup tables to unpack a byte of 1bpp pixels to 8 indices and a byte of 4bpp pixels to 2 indices */
+#define BMP_BITS1(n) \
+    { \
+        ((n) >> 7) & 1, ((n) >> 6) & 1, ((n) >> 5) & 1, ((n) >> 4) & 1, ((n) >> 3) & 1, ((n) >> 2) & 1, ((n) >> 1) & 1, \
+            (n)&1 \
+    }
+#define BMP_BITS4(n) BMP_BITS1(n), BMP_BITS1(n + 1), BMP_BITS1(n + 2), BMP_BITS1(n + 3)
+#define BMP_BITS16(n) BMP_BITS4(n), BMP_BITS4(n + 4), BMP_BITS4(n + 8), BMP_BITS4(n + 12)
+#define BMP_BITS64(n) BMP_BITS16(n), BMP_BITS16(n + 16), BMP_BITS16(n + 32), BMP_BITS16(n + 48)
+#define BMP_NIBBLES1(n) \
+    { \
+        (n) >> 4, (n)&15 \
+    }
+#define BMP_NIBBLES4(n) BMP_NIBBLES1(n), BMP_NIBBLES1(n + 1), BMP_NIBBLES1(n + 2), BMP_NIBBLES1(n + 3)
+#define BMP_NIBBLES16(n) BMP_NIBBLES4(n), BMP_NIBBLES4(n + 4), BMP_NIBBLES4(n + 8), BMP_NIBBLES4(n + 12)
+#define BMP_NIBBLES64(n) BMP_NIBBLES16(n), BMP_NIBBLES16(n + 16), BMP_NIBBLES16(n + 32), BMP_NIBBLES16(n + 48)
+
+static const uint8_t BMP_unpacktbl1[256][8] = { BMP_BITS64(0), BMP_BITS64(64), BMP_BITS64(128), BMP_BITS64(192) };
+static const uint8_t BMP_unpacktbl4[256][2] = {
+    BMP_NIBBLES64(0), BMP_NIBBLES64(64), BMP_NIBBLES64(128), BMP_NIBBLES64(192)
+};
+
+void BMP_unpack1(uint8_t *dst, const uint8_t *src, int count)
+{
+    for (; count >= 8; count -= 8) {
+        memcpy(dst, BMP_unpacktbl1[*src++], 8);
+        dst += 8;
+    }
+
+    if (count > 0) {
+        memcpy(dst, BMP_unpacktbl1[*src], count);
+    }
+}
+
+void BMP_unpack4(uint8_t *dst, const uint8_t *src, int count)
+{
+    for (; count >= 2; count -= 2) {
+        memcpy(dst, BMP_unpacktbl4[*src++], 2);
+        dst += 2;
+    }
+
+    if (count > 0) {
+        *dst = BMP_unpacktbl4[*src][0];
+    }
+}
+
+/* Decodes RLE compressed image data that has already been read in full so packets cost no stream calls */
+int BMP_decoderle(const uint8_t *src, const uint8_t *end, uint8_t *dst, int pitch, int width, int height, int bpp)
+{
+    int pixel_size = bpp <= 8 ? 1 : 4;
+    uint8_t *rowp = dst;
+    int x = 0;
+    int y = 0;
+
+    while (y < height && end - src >= 2) {
+        int count = src[0];
+        int value = src[1];
+        int fill;
+        uint8_t *putp;
+
+        src += 2;
+
+        if (count == 0 && value < 3) {
+            switch (value) {
+                case 0: /* End of line */
+                    x = 0;
+                    ++y;
+                    rowp += pitch;
+                    break;
+                case 1: /* End of bitmap */
+                    return 1;
+                case 2: /* Delta, skipped pixels are left as index 0 */
+                    if (end - src < 2) {
+                        return 0;
+                    }
+
+                    x += src[0];
+                    y += src[1];
+                    rowp += pitch * src[1];
+                    src += 2;
+                    break;
+            }
+
+            continue;
+        }
+
+        /* Packets that would run past the end of the row still consume their data but are clipped to the row */
+        fill = count != 0 ? count : value;
+        fill = fill < width - x ? fill : width - x;
+        fill = fill > 0 ? fill : 0;
+        putp = rowp + x * pixel_size;
+
+        if (count != 0) {
+            /* Encoded run, the pixels are repeated from value */
+            switch (bpp) {
+                case 1:
+                    for (int i = 0; i < fill; ++i) {
+                        putp[i] = BMP_unpacktbl1[value][i & 7];
+                    }
+                    break;
+                case 4:
+                    for (int i = 0; i < fill; ++i) {
+                        putp[i] = BMP_unpacktbl4[value][i & 1];
+                    }
+                    break;
+                case 8:
+                    memset(putp, value, fill);
+                    break;
+                case 24:
+                    if (end - src < 2) {
+                        return 0;
+                    }
+
+                    for (int i = 0; i < fill; ++i) {
+                        ((ARGB *)putp)->a = 255;
+                        ((ARGB *)putp)->r = src[1];
+                        ((ARGB *)putp)->g = src[0];
+                        ((ARGB *)putp)->b = value;
+                        putp += 4;
+                    }
+
+                    src += 2;
+                    break;
+            }
+
+            x += count;
+        } else {
+            /* Absolute run, value pixels follow padded to a 16bit boundary */
+            int size = bpp == 24 ? value * 3 : (value * bpp + 7) >> 3;
+
+            if (end - src < size) {
+                return 0;
+            }
+
+            switch (bpp) {
+                case 1:
+                    BMP_unpack1(putp, src, fill);
+                    break;
+                case 4:
+                    BMP_unpack4(putp, src, fill);
+                    break;
+                case 8:
+                    memcpy(putp, src, fill);
+                    break;
+                case 24:
+                    for (int i = 0; i < fill; ++i) {
+                        ((ARGB *)putp)->a = 255;
+                        ((ARGB *)putp)->r = src[3 * i + 2];
+                        ((ARGB *)putp)->g = src[3 * i + 1];
+                        ((ARGB *)putp)->b = src[3 * i];
+                        putp += 4;
+                    }
+                    break;
+            }
+
+            size += size & 1;
+            src += size < end - src ? size : end - src;
+            x += value;
+        }
+    }
+
+    return y >= height;
+}
+
 static int BMP_readline(GSTREAM *stream,
     uint8_t *dst,
     uint8_t *buffer,
@@ -58,198 +223,80 @@ static int BMP_readline(GSTREAM *stream,
     uint32_t g_mask,
     uint32_t b_mask)
 {
-    int bytes_read = 0;
     uint8_t *getp = buffer;
     int actual_bpp = bpp != 15 ? bpp : 16;
-    int retval = 0;
-    int run_count = 0;
-    int pitch;
-
-    if (info->packed != 0) {
-        int xpos = 0;
-
-        do {
-            gread(stream, getp, 1);
-            ++bytes_read;
-            run_count = *getp;
-            getp = buffer;
-
-            if (run_count != 0) {
-                xpos += run_count;
-                gread(stream, getp, 1);
-                ++bytes_read;
-
-                switch (bpp) {
-                    case 1:
-                        for (int i = 0; i < run_count; ++i) {
-                            *dst++ = (*getp >> (7 - (i & 7))) & 1;
-                        }
-                        break;
-                    case 4:
-                        for (int i = 0; i < run_count; ++i) {
-                            if ((i & 1) != 0) {
-                                *dst++ = *getp & 0xF;
-                            } else {
-                                *dst++ = *getp >> 4;
-                            }
-                        }
-                        break;
-                    case 8:
-                        for (int i = 0; i < run_count; ++i) {
-                            *dst++ = *getp;
-                        }
-                        break;
-                    case 24:
-                        gread(stream, getp + 1, 2);
-                        bytes_read += 2;
-                        for (int i = 0; i < run_count; ++i) {
-                            ((ARGB *)dst)->a = 255;
-                            ((ARGB *)dst)->r = getp[2];
-                            ((ARGB *)dst)->g = getp[1];
-                            ((ARGB *)dst)->b = getp[0];
-                        }
-                        break;
-                }
-            } else {
-                retval = gread(stream, getp, 1);
-                ++bytes_read;
-                run_count = *getp;
-
-                if (run_count >= 3) {
-                    xpos += run_count;
-                    pitch = ((bpp * run_count + 15) >> 3) & ~1;
-                    bytes_read += pitch;
-                    retval = gread(stream, getp, pitch);
-
-                    switch (bpp) {
-                        case 1:
-                            for (int i = 0; i < run_count; ++i) {
-                                *dst++ = (*getp++ >> (7 - (i & 7))) & 1;
-                            }
-                            break;
-                        case 4:
-                            for (int i = 0; i < run_count; ++i) {
-                                if (i & 1) {
-                                    *dst++ = *getp++ & 0xF;
-                                } else {
-                                    *dst++ = *getp >> 4;
-                                }
-                            }
-                            break;
-                        case 8:
-                            for (int i = 0; i < run_count; ++i) {
-                                *dst++ = *getp++;
-                            }
-                            break;
-                        case 24:
-                            for (int i = 0; i < run_count; ++i) {
-                                ((ARGB *)dst)->a = 255;
-                                ((ARGB *)dst)->r = getp[2];
-                                ((ARGB *)dst)->g = getp[1];
-                                ((ARGB *)dst)->b = getp[0];
-                                dst += 4;
-                                getp += 3;
-                            }
-                            break;
-                    }
-                } else if (xpos != 0) {
-                    break;
-                }
+    int run_count = info->width;
+    int pitch = ((run_count * actual_bpp + 31) >> 3) & ~3;
+    int retval = gread(stream, getp, pitch);
+
+    switch (bpp) {
+        case 1:
+            BMP_unpack1(dst, getp, run_count);
+            break;
+        case 4:
+            BMP_unpack4(dst, getp, run_count);
+            break;
+        case 8:
+            memcpy(dst, getp, run_count);
+            break;
+        case 24:
+            for (int i = 0; i < run_count; ++i) {
+                ((ARGB *)dst)->a = 255;
+                ((ARGB *)dst)->r = getp[2];
+                ((ARGB *)dst)->g = getp[1];
+                ((ARGB *)dst)->b = getp[0];
+                dst += 4;
+                getp += 3;
             }
-        } while (xpos < info->width);
-    } else {
-        run_count = info->width;
-        pitch = ((run_count * actual_bpp + 31) >> 3) & ~3;
-        bytes_read += pitch;
-        retval = gread(stream, getp, pitch);
-
-        switch (bpp) {
-            case 1:
-                for (int i = 0; i < run_count; ++i) {
-                    *dst++ = (*getp >> (7 - (i & 7))) & 1;
-
-                    if ((i & 7) == 7) {
-                        ++getp;
-                    }
+            break;
+        case 15:
+        case 16:
+        case 32: {
+            int aoffset;
+            int roffset;
+            int goffset;
+            int boffset;
+            int acolors = 1 << info->alpha_bits;
+            int rcolors = 1 << info->red_bits;
+            int gcolors = 1 << info->green_bits;
+            int bcolors = 1 << info->blue_bits;
+
+            aoffset = BMP_maskoffset(a_mask);
+            roffset = BMP_maskoffset(r_mask);
+            goffset = BMP_maskoffset(g_mask);
+            boffset = BMP_maskoffset(b_mask);
+
+            for (int i = 0; i < run_count; ++i) {
+                uint32_t pixel;
+
+                if (bpp != 32) {
+                    pixel = le16toh(*(uint16_t *)getp);
+                } else {
+                    pixel = le32toh(*(uint32_t *)getp);
                 }
-                break;
-            case 4:
-                for (int i = 0; i < run_count; ++i) {
-                    if (i & 1) {
-                        *dst++ = *getp++ & 0xF;
+
+                if (a_mask) {
+                    unsigned temp = (a_mask & pixel) >> aoffset;
+                    if (acolors != 1) {
+                        temp = ((acolors >> 1) + 255 * temp) / (acolors - 1);
                     } else {
-                        *dst++ = *getp >> 4;
+                        temp = (-(char)temp) & 0xFF;
                     }
-                }
-                break;
-            case 8:
-                for (int i = 0; i < run_count; ++i) {
-                    *dst++ = *getp++;
-                }
-                break;
-            case 24:
-                for (int i = 0; i < run_count; ++i) {
+                    ((ARGB *)dst)->a = temp;
+                } else {
                     ((ARGB *)dst)->a = 255;
-                    ((ARGB *)dst)->r = getp[2];
-                    ((ARGB *)dst)->g = getp[1];
-                    ((ARGB *)dst)->b = getp[0];
-                    dst += 4;
-                    getp += 3;
                 }
-                break;
-            case 15:
-            case 16:
-            case 32: {
-                int aoffset;
-                int roffset;
-                int goffset;
-                int boffset;
-                int acolors = 1 << info->alpha_bits;
-                int rcolors = 1 << info->red_bits;
-                int gcolors = 1 << info->green_bits;
-                int bcolors = 1 << info->blue_bits;
-
-                aoffset = BMP_maskoffset(a_mask);
-                roffset = BMP_maskoffset(r_mask);
-                goffset = BMP_maskoffset(g_mask);
-                boffset = BMP_maskoffset(b_mask);
-
-                for (int i = 0; i < run_count; ++i) {
-                    uint32_t pixel;
-
-                    if (bpp != 32) {
-                        pixel = le16toh(*(uint16_t *)getp);
-                    } else {
-                        pixel = le32toh(*(uint32_t *)getp);
-                    }
-
-                    if (a_mask) {
-                        unsigned temp = (a_mask & pixel) >> aoffset;
-                        if (acolors != 1) {
-                            temp = ((acolors >> 1) + 255 * temp) / (acolors - 1);
-                        } else {
-                            temp = (-(char)temp) & 0xFF;
-                        }
-                        ((ARGB *)dst)->a = temp;
-                    } else {
-                        ((ARGB *)dst)->a = 255;
-                    }
 
-                    ((ARGB *)dst)->r = (uint8_t)((((pixel & r_mask) >> roffset) * 255 + (rcolors >> 1)) / (rcolors - 1));
-                    ((ARGB *)dst)->g = (uint8_t)((((pixel & g_mask) >> goffset) * 255 + (gcolors >> 1)) / (gcolors - 1));
-                    ((ARGB *)dst)->b = (uint8_t)((((pixel & b_mask) >> boffset) * 255 + (bcolors >> 1)) / (bcolors - 1));
-                    dst += 4;
-                    getp += bpp == 16 ? 2 : 4;
-                }
-                break;
+                ((ARGB *)dst)->r = (uint8_t)((((pixel & r_mask) >> roffset) * 255 + (rcolors >> 1)) / (rcolors - 1));
+                ((ARGB *)dst)->g = (uint8_t)((((pixel & g_mask) >> goffset) * 255 + (gcolors >> 1)) / (gcolors - 1));
+                ((ARGB *)dst)->b = (uint8_t)((((pixel & b_mask) >> boffset) * 255 + (bcolors >> 1)) / (bcolors - 1));
+                dst += 4;
+                getp += bpp != 32 ? 2 : 4;
             }
+            break;
         }
     }
 
-    if (bytes_read & 3) {
-        gread(stream, getp, -bytes_read & 3);
-    }
-
     return retval;
 }
 
@@ -670,6 +717,55 @@ GINFO *GIMEX_API BMP_info(GINSTANCE *ctx, int frame)
     return info;
 }
 
+int GIMEX_API BMP_dims(GINSTANCE *ctx, int *width, int *height, int *bpp)
+{
+    BITMAPHEADER header;
+    uint32_t header_size;
+    int32_t bmp_width;
+    int32_t bmp_height;
+    int32_t bmp_bpp;
+
+    gseek(ctx->stream, 0);
+
+    /* Only the fixed part of the header is needed, palettes and masks are left unread */
+    if (!gread(ctx->stream, &header, sizeof(header.file) + sizeof(BITMAPCOREHEADER))) {
+        return 0;
+    }
+
+    header_size = le32toh(header.bmp.size);
+
+    if (header_size < sizeof(BITMAPINFOHEADER)) {
+        const BITMAPCOREHEADER *core = (const BITMAPCOREHEADER *)&header.bmp;
+        bmp_width = le16toh(core->width);
+        bmp_height = le16toh(core->height);
+        bmp_bpp = le16toh(core->bit_count);
+    } else {
+        if (!gread(ctx->stream,
+                (uint8_t *)&header.bmp + sizeof(BITMAPCOREHEADER),
+                sizeof(BITMAPINFOHEADER) - sizeof(BITMAPCOREHEADER))) {
+            return 0;
+        }
+
+        bmp_width = le32toh(header.bmp.width);
+        bmp_height = le32toh(header.bmp.height);
+        bmp_bpp = le16toh(header.bmp.bit_count);
+    }
+
+    if (width != NULL) {
+        *width = bmp_width;
+    }
+
+    if (height != NULL) {
+        *height = bmp_height < 0 ? -bmp_height : bmp_height;
+    }
+
+    if (bpp != NULL) {
+        *bpp = bmp_bpp <= 8 ? 8 : 32;
+    }
+
+    return 1;
+}
+
 int GIMEX_API BMP_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
 {
     BITMAPHEADER header;
@@ -689,6 +785,8 @@ int GIMEX_API BMP_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
     int32_t compression = BI_RGB;
     int32_t offset;
     int retval = 0;
+    bool expand = false;
+    uint32_t palette[GIMEX_COLOURTBL_SIZE];
 
     colors = info->num_colors;
     type = info->sub_type;
@@ -760,6 +858,56 @@ int GIMEX_API BMP_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
     }
 
     retval = gseek(ctx->stream, offset);
+
+    /* Caller asked for ARGB from a paletted image, expand each row in place while it is still in cache */
+    if (info->bpp == 32 && bpp <= 8) {
+        GIMEX_packpalette(palette, info->colortbl);
+        expand = true;
+    }
+
+    /* Compressed data is read in one go and decoded from memory, packets are too small to read individually */
+    if (info->packed) {
+        int64_t data_size = glen(ctx->stream) - offset;
+        uint8_t *data;
+        char *putp = buffer;
+        int32_t row_pitch = pitch;
+
+        if (retval == 0 || data_size <= 0) {
+            return 0;
+        }
+
+        data = galloc((uint32_t)data_size);
+
+        if (data == NULL) {
+            return 0;
+        }
+
+        for (int y = 0; y < height; ++y) {
+            memset(buffer + pitch * y, 0, bpp <= 8 ? width : width * sizeof(ARGB));
+        }
+
+        if (header.bmp.height >= 0) {
+            putp = buffer + (pitch * (height - 1));
+            row_pitch = -pitch;
+        }
+
+        if (gread(ctx->stream, data, (int32_t)data_size) == data_size) {
+            retval = BMP_decoderle(data, data + data_size, (uint8_t *)putp, row_pitch, width, height, bpp);
+        } else {
+            retval = 0;
+        }
+
+        gfree(data);
+
+        if (expand) {
+            for (int y = 0; y < height; ++y) {
+                GIMEX_expand8((uint32_t *)(buffer + pitch * y), (uint8_t *)(buffer + pitch * y), palette, width);
+            }
+        }
+
+        return retval;
+    }
+
     actual_bpp = bpp != 15 ? bpp : 16;
     line_buffer = galloc(((width * actual_bpp + 31) & ~31) >> 3);
 
@@ -773,6 +921,10 @@ int GIMEX_API BMP_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
             if (retval != 0) {
                 retval = BMP_readline(
                     ctx->stream, (uint8_t *)putp, line_buffer, bpp, info, alpha_mask, red_mask, green_mask, blue_mask);
+
+                if (expand) {
+                    GIMEX_expand8((uint32_t *)putp, (uint8_t *)putp, palette, width);
+                }
             }
 
             putp -= pitch;
@@ -783,6 +935,10 @@ int GIMEX_API BMP_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
             if (retval != 0) {
                 retval = BMP_readline(
                     ctx->stream, (uint8_t *)putp, line_buffer, bpp, info, alpha_mask, red_mask, green_mask, blue_mask);
+
+                if (expand) {
+                    GIMEX_expand8((uint32_t *)putp, (uint8_t *)putp, palette, width);
+                }
             }
 
             putp += pitch;
@@ -1037,40 +1193,47 @@ int GIMEX_API BMP_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
     return retval;
 }
 
+static const GABOUT BMP_aboutinfo = {
+    .signature = GIMEX_ID('.', 'B', 'M', 'P'),
+    .size = sizeof(GABOUT),
+    .version = GIMEX_VERSION,
+    .can_import = 1,
+    .can_export = 1,
+    .import_packed = 1,
+    .export_packed = 1,
+    .import_paletted = 1,
+    .export_paletted = 1,
+    .import_argb = 1,
+    .export_argb = 1,
+    .multi_frame = 0,
+    .multi_file = 0,
+    .multi_size = 1,
+    .requires_frame_buffer = 0,
+    .external = 0,
+    .uses_file = 1,
+    .max_frame_name = 0,
+    .default_quality = 100,
+    .mac_type = { GIMEX_ID('B', 'I', 'N', 'A'), GIMEX_ID('.', 'B', 'M', 'P') },
+    .extensions = { ".bmp" },
+    .author_str = "Assembly Armada",
+    .version_str = "1.00",
+    .short_type = "BMP",
+    .word_type = "BMP",
+    .long_type = "Windows Bitmap",
+};
+
 GABOUT *GIMEX_API BMP_about(void)
 {
     GABOUT *about = galloc(sizeof(GABOUT));
 
     if (about != NULL) {
-        memset(about, 0, sizeof(GABOUT));
-        about->signature = GIMEX_ID('.', 'B', 'M', 'P');
-        about->size = sizeof(GABOUT);
-        about->version = GIMEX_VERSION;
-        about->can_import = 1;
-        about->can_export = 1;
-        about->import_packed = 1;
-        about->export_packed = 1;
-        about->import_paletted = 1;
-        about->export_paletted = 1;
-        about->import_argb = 1;
-        about->export_argb = 1;
-        about->multi_frame = 0;
-        about->multi_file = 0;
-        about->multi_size = 1;
-        about->requires_frame_buffer = 0;
-        about->external = 0;
-        about->uses_file = 1;
-        about->max_frame_name = 0;
-        about->default_quality = 100;
-        about->mac_type[0] = GIMEX_ID('B', 'I', 'N', 'A');
-        about->mac_type[1] = GIMEX_ID('.', 'B', 'M', 'P');
-        strcpy(about->extensions[0], ".bmp");
-        strcpy(about->author_str, "Assembly Armada");
-        strcpy(about->version_str, "1.00");
-        strcpy(about->short_type, "BMP");
-        strcpy(about->word_type, "BMP");
-        strcpy(about->long_type, "Windows Bitmap");
+        memcpy(about, &BMP_aboutinfo, sizeof(GABOUT));
     }
 
     return about;
 }
+
+const GABOUT *GIMEX_API BMP_aboutref(void)
+{
+    return &BMP_aboutinfo;
+}
@@ -31,9 +31,38 @@ int GIMEX_API BMP_close(GINSTANCE *ctx);
 int GIMEX_API BMP_wopen(GINSTANCE **ctx, GSTREAM *stream, const char *unk1, bool unk2);
 int GIMEX_API BMP_wclose(GINSTANCE *ctx);
 GINFO *GIMEX_API BMP_info(GINSTANCE *ctx, int frame);
+int GIMEX_API BMP_dims(GINSTANCE *ctx, int *width, int *height, int *bpp);
 int GIMEX_API BMP_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch);
 int GIMEX_API BMP_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pitch);
 GABOUT *GIMEX_API BMP_about(void);
+const GABOUT *GIMEX_API BMP_aboutref(void);
+
+/**
+ * @brief Unpacks a row of 1bpp pixels to one 8bit index per pixel.
+ * @param dst Pointer to the destination row.
+ * @param src Pointer to the packed pixels, most significant bit first.
+ * @param count Number of pixels to unpack.
+ */
+void BMP_unpack1(uint8_t *dst, const uint8_t *src, int count);
+/**
+ * @brief Unpacks a row of 4bpp pixels to one 8bit index per pixel.
+ * @param dst Pointer to the destination row.
+ * @param src Pointer to the packed pixels, high nibble first.
+ * @param count Number of pixels to unpack.
+ */
+void BMP_unpack4(uint8_t *dst, const uint8_t *src, int count);
+/**
+ * @brief Decodes RLE compressed image data that has already been read into memory.
+ * @param src Pointer to the compressed data.
+ * @param end Pointer to the end of the compressed data.
+ * @param dst Pointer to the first row to decode, pixels are 8bit indices up to 8bpp and ARGB above.
+ * @param pitch Distance in bytes from one row to the next, negative to decode bottom up.
+ * @param width Width of the image in pixels, packets running past it are clipped.
+ * @param height Height of the image in rows, decoding stops once it is reached.
+ * @param bpp Bits per pixel of the compressed data, 1, 4, 8 or 24.
+ * @return 1 if the image was decoded, 0 if the data ran out first.
+ */
+int BMP_decoderle(const uint8_t *src, const uint8_t *end, uint8_t *dst, int pitch, int width, int height, int bpp);
 
 #ifdef __cplusplus
 } // extern "C"
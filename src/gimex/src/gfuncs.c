@@ -19,56 +19,63 @@
 #include "targagimex.h"
 #include <stddef.h>
 
+/* Expands to the table entry for a codec that implements the full set of X_ prefixed GIMEX functions. */
+#define GIMEX_CODEC(x) \
+    { \
+        x##_about, x##_is, x##_open, x##_info, x##_read, x##_close, x##_wopen, x##_write, x##_wclose, x##_dims, \
+            x##_aboutref \
+    }
+
 GimexFunctions gFunctions[] = {
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { FSH_about, FSH_is, FSH_open, FSH_info, FSH_read, FSH_close, FSH_wopen, FSH_write, FSH_wclose },
-    { JPG_about, JPG_is, JPG_open, JPG_info, JPG_read, JPG_close, JPG_wopen, JPG_write, JPG_wclose },
-    { IJL_about, IJL_is, IJL_open, IJL_info, IJL_read, IJL_close, IJL_wopen, IJL_write, IJL_wclose },
-    { PNG_about, PNG_is, PNG_open, PNG_info, PNG_read, PNG_close, PNG_wopen, PNG_write, PNG_wclose },
-    { BMP_about, BMP_is, BMP_open, BMP_info, BMP_read, BMP_close, BMP_wopen, BMP_write, BMP_wclose },
-    { TGA_about, TGA_is, TGA_open, TGA_info, TGA_read, TGA_close, TGA_wopen, TGA_write, TGA_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL_about, NULL_is, NULL_open, NULL_info, NULL_read, NULL_close, NULL_wopen, NULL_write, NULL_wclose },
-    { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(FSH),
+    GIMEX_CODEC(JPG),
+    GIMEX_CODEC(IJL),
+    GIMEX_CODEC(PNG),
+    GIMEX_CODEC(BMP),
+    GIMEX_CODEC(TGA),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    GIMEX_CODEC(NULL),
+    { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
 };
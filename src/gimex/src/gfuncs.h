@@ -25,6 +25,8 @@ typedef struct _GimexFunctions
     int(GIMEX_API *wopen)(GINSTANCE **, GSTREAM *, const char *, bool);
     int(GIMEX_API *write)(GINSTANCE *, const GINFO *, char *, int);
     int(GIMEX_API *wclose)(GINSTANCE *);
+    int(GIMEX_API *dims)(GINSTANCE *, int *, int *, int *);
+    const GABOUT *(GIMEX_API *aboutref)();
 } GimexFunctions;
 
 extern GimexFunctions gFunctions[];
@@ -47,6 +47,11 @@ GINFO *GIMEX_API GIMEX_info(GINSTANCE *ctx, int frame)
     return gFunctions[gCurrentGimex].info(ctx, frame);
 }
 
+bool GIMEX_API GIMEX_dims(GINSTANCE *ctx, int *width, int *height, int *bpp)
+{
+    return gFunctions[gCurrentGimex].dims(ctx, width, height, bpp) != 0;
+}
+
 bool GIMEX_API GIMEX_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
 {
     return gFunctions[gCurrentGimex].read(ctx, info, buffer, pitch) != 0;
@@ -62,6 +67,11 @@ GABOUT *GIMEX_API GIMEX_about(void)
     return gFunctions[gCurrentGimex].about();
 }
 
+const GABOUT *GIMEX_API GIMEX_aboutref(void)
+{
+    return gFunctions[gCurrentGimex].aboutref();
+}
+
 int GIMEX_max()
 {
     int max_codec = 0;
@@ -148,14 +158,14 @@ int GIMEX_API GIMEX_find(const char *formats, int *format_index)
             }
 
             for (int j = 1; j < GIMEX_max(); ++j) {
-                GABOUT *about;
+                const GABOUT *about;
 
                 if (current_best >= 4) {
                     break;
                 }
 
                 GIMEX_set(j);
-                about = GIMEX_about();
+                about = GIMEX_aboutref();
 
                 if (about != NULL) {
                     if (!GIMEX_strcmp(about->extensions[i], ext_buffer)) {
@@ -174,8 +184,6 @@ int GIMEX_API GIMEX_find(const char *formats, int *format_index)
                             }
                         }
                     }
-
-                    gfree(about);
                 }
             }
         }
@@ -184,3 +192,40 @@ int GIMEX_API GIMEX_find(const char *formats, int *format_index)
     GIMEX_set(gimex_format);
     return gimex_format;
 }
+
+bool GIMEX_API GIMEX_scan(GSTREAM *stream, GSCAN *scan)
+{
+    GINSTANCE instance;
+    int best_score = 0;
+    int best_codec = 0;
+
+    /* Walk the table directly rather than through GIMEX_set so concurrent scans don't race on the current codec */
+    for (int i = 1; gFunctions[i].about != NULL; ++i) {
+        int score = gFunctions[i].is(stream);
+
+        if (score > best_score) {
+            best_score = score;
+            best_codec = i;
+
+            if (score >= 100) {
+                break;
+            }
+        }
+    }
+
+    if (best_codec == 0) {
+        return false;
+    }
+
+    instance.signature = gFunctions[best_codec].aboutref()->signature;
+    instance.size = sizeof(GINSTANCE);
+    instance.frames = 1;
+    instance.frame_num = 0;
+    instance.stream = stream;
+    instance.image_context = NULL;
+
+    scan->signature = instance.signature;
+    scan->codec = best_codec;
+
+    return gFunctions[best_codec].dims(&instance, &scan->width, &scan->height, &scan->bpp) != 0;
+}
@@ -73,7 +73,7 @@ int main(int argc, char **argv)
     GSTREAM stream;
     GINFO *info;
     GINSTANCE *instance;
-    GABOUT *about;
+    const GABOUT *about;
     int gimex_index;
     const char *src_name;
     const char *dst_name;
@@ -106,15 +106,13 @@ int main(int argc, char **argv)
         }
 
         if (GIMEX_is(&stream)) {
-            about = GIMEX_about();
+            about = GIMEX_aboutref();
 
             if (about != NULL) {
                 gimex_index = GIMEX_get();
                 printf("Using GIMEX module '%s' (%d) for source file '%s'.\n", about->long_type, gimex_index, src_name);
             }
 
-            gfree(about);
-
             GIMEX_open(&instance, &stream, src_name, 0);
             info = GIMEX_info(instance, 0);
             buffer = galloc(info->width * info->height * info->bpp / 8);
@@ -138,14 +136,12 @@ int main(int argc, char **argv)
                 return -1;
             }
 
-            about = GIMEX_about();
+            about = GIMEX_aboutref();
 
             if (about != NULL) {
                 printf("Using GIMEX module '%s' (%d) for destination file '%s'.\n", about->long_type, gimex_index, dst_name);
             }
 
-            gfree(about);
-
             stream.fp = fopen(dst_name, "wb");
 
             if (stream.fp != NULL) {
@@ -0,0 +1,183 @@
+/**
+ * @file
+ *
+ * @brief Compact binary catalog of image dimensions built from GIMEX_scan results.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include <gimexindex.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct GINDEXSORT
+{
+    const char *name;
+    int index;
+} GINDEXSORT;
+
+static int GIMEX_index_compare(const void *a, const void *b)
+{
+    return strcmp(((const GINDEXSORT *)a)->name, ((const GINDEXSORT *)b)->name);
+}
+
+static const GINDEXENTRY *GIMEX_index_entries(const void *index)
+{
+    return (const GINDEXENTRY *)((const uint8_t *)index + sizeof(GINDEXHEADER));
+}
+
+static const char *GIMEX_index_names(const void *index)
+{
+    const GINDEXHEADER *header = index;
+    return (const char *)(GIMEX_index_entries(index) + le32toh(header->count));
+}
+
+bool GIMEX_API GIMEX_index_write(GSTREAM *stream, const GSCAN *scans, const char *const *names, int count)
+{
+    GINDEXHEADER header;
+    GINDEXSORT *order;
+    GINDEXENTRY *entries;
+    uint32_t names_size = 0;
+    bool retval = false;
+
+    if (count < 0) {
+        return false;
+    }
+
+    /* A spare entry keeps the allocations non zero when writing an empty index */
+    order = galloc(sizeof(GINDEXSORT) * (count + 1));
+    entries = galloc(sizeof(GINDEXENTRY) * (count + 1));
+
+    if (order == NULL || entries == NULL) {
+        goto cleanup;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        order[i].name = names[i];
+        order[i].index = i;
+    }
+
+    /* Sorting by name lets readers binary search the mapped file without building any lookup structures */
+    qsort(order, count, sizeof(GINDEXSORT), GIMEX_index_compare);
+
+    for (int i = 0; i < count; ++i) {
+        const GSCAN *scan = &scans[order[i].index];
+        size_t length = strlen(order[i].name);
+
+        if (length > UINT16_MAX) {
+            goto cleanup;
+        }
+
+        entries[i].name_offset = htole32(names_size);
+        entries[i].signature = htole32(scan->signature);
+        entries[i].width = htole32(scan->width);
+        entries[i].height = htole32(scan->height);
+        entries[i].bpp = htole16(scan->bpp);
+        entries[i].name_length = htole16(length);
+        names_size += length + 1;
+    }
+
+    header.signature = htole32(GIMEX_INDEX_SIGNATURE);
+    header.version = htole32(GIMEX_INDEX_VERSION);
+    header.count = htole32(count);
+    header.names_size = htole32(names_size);
+
+    if (gwrite(stream, &header, sizeof(header)) != sizeof(header)) {
+        goto cleanup;
+    }
+
+    if (gwrite(stream, entries, sizeof(GINDEXENTRY) * count) != sizeof(GINDEXENTRY) * count) {
+        goto cleanup;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        int32_t length = le16toh(entries[i].name_length) + 1;
+
+        if (gwrite(stream, (void *)order[i].name, length) != (uint32_t)length) {
+            goto cleanup;
+        }
+    }
+
+    retval = true;
+
+cleanup:
+    gfree(entries);
+    gfree(order);
+
+    return retval;
+}
+
+bool GIMEX_API GIMEX_index_valid(const void *index, size_t size)
+{
+    const GINDEXHEADER *header = index;
+    const GINDEXENTRY *entries;
+    const char *names;
+    uint32_t count;
+    uint32_t names_size;
+
+    if (index == NULL || size < sizeof(GINDEXHEADER)) {
+        return false;
+    }
+
+    if (le32toh(header->signature) != GIMEX_INDEX_SIGNATURE || le32toh(header->version) != GIMEX_INDEX_VERSION) {
+        return false;
+    }
+
+    count = le32toh(header->count);
+    names_size = le32toh(header->names_size);
+
+    if ((size - sizeof(GINDEXHEADER)) / sizeof(GINDEXENTRY) < count
+        || size - sizeof(GINDEXHEADER) - sizeof(GINDEXENTRY) * count < names_size) {
+        return false;
+    }
+
+    entries = GIMEX_index_entries(index);
+    names = GIMEX_index_names(index);
+
+    /* Check every name is in bounds and terminated once here so lookups don't have to */
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t offset = le32toh(entries[i].name_offset);
+        uint32_t length = le16toh(entries[i].name_length);
+
+        if (offset >= names_size || names_size - offset <= length || names[offset + length] != '\0') {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const GINDEXENTRY *GIMEX_API GIMEX_index_find(const void *index, const char *name)
+{
+    const GINDEXHEADER *header = index;
+    const GINDEXENTRY *entries = GIMEX_index_entries(index);
+    const char *names = GIMEX_index_names(index);
+    uint32_t low = 0;
+    uint32_t high = le32toh(header->count);
+
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        int result = strcmp(name, names + le32toh(entries[mid].name_offset));
+
+        if (result == 0) {
+            return &entries[mid];
+        }
+
+        if (result < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+
+    return NULL;
+}
+
+const char *GIMEX_API GIMEX_index_name(const void *index, const GINDEXENTRY *entry)
+{
+    return GIMEX_index_names(index) + le32toh(entry->name_offset);
+}
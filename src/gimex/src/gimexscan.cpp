@@ -0,0 +1,183 @@
+/**
+ * @file
+ *
+ * @brief Utility to build a catalog index of image dimensions from a list of files.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include <gimex.h>
+#include <gimexindex.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct GSTREAM
+{
+    FILE *fp;
+};
+
+void *GIMEX_API galloc(uint32_t size)
+{
+    return malloc(size);
+}
+
+int GIMEX_API gfree(void *ptr)
+{
+    free(ptr);
+    return true;
+}
+
+uint32_t GIMEX_API gread(GSTREAM *stream, void *dst, int32_t size)
+{
+    if (size < 0) {
+        return 0;
+    }
+
+    return uint32_t(fread(dst, 1, size, stream->fp));
+}
+
+uint32_t GIMEX_API gwrite(GSTREAM *stream, void *src, int32_t size)
+{
+    if (size < 0) {
+        return 0;
+    }
+
+    return uint32_t(fwrite(src, 1, size, stream->fp));
+}
+
+int GIMEX_API gseek(GSTREAM *stream, uint32_t pos)
+{
+    return fseek(stream->fp, pos, SEEK_SET) == 0;
+}
+
+int64_t GIMEX_API glen(GSTREAM *stream)
+{
+    long start = ftell(stream->fp);
+    fseek(stream->fp, 0, SEEK_END);
+    long len = ftell(stream->fp);
+    fseek(stream->fp, start, SEEK_SET);
+    return len;
+}
+
+// Arguments starting with @ name a text file containing one path per line.
+static bool AddFiles(std::vector<std::string> &files, const char *arg)
+{
+    if (arg[0] != '@') {
+        files.emplace_back(arg);
+        return true;
+    }
+
+    FILE *fp = fopen(arg + 1, "r");
+
+    if (fp == nullptr) {
+        return false;
+    }
+
+    char line[1024];
+
+    while (fgets(line, sizeof(line), fp) != nullptr) {
+        size_t len = strcspn(line, "\r\n");
+        line[len] = '\0';
+
+        if (len != 0) {
+            files.emplace_back(line);
+        }
+    }
+
+    fclose(fp);
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3) {
+        printf("Usage: gimexscan <index file> <image files or @list files...>\n");
+        return -1;
+    }
+
+    std::vector<std::string> files;
+
+    for (int i = 2; i < argc; ++i) {
+        if (!AddFiles(files, argv[i])) {
+            printf("Failed to open file list '%s'!\n", argv[i] + 1);
+            return -1;
+        }
+    }
+
+    std::vector<GSCAN> scans(files.size());
+    std::vector<char> found(files.size());
+    std::atomic<size_t> next(0);
+
+    // GIMEX_scan doesn't touch the current codec so each worker just pulls the next file until the list is exhausted.
+    auto worker = [&]() {
+        for (size_t i = next++; i < files.size(); i = next++) {
+            GSTREAM stream;
+            stream.fp = fopen(files[i].c_str(), "rb");
+
+            if (stream.fp != nullptr) {
+                found[i] = GIMEX_scan(&stream, &scans[i]);
+                fclose(stream.fp);
+            }
+        }
+    };
+
+    unsigned thread_count = std::thread::hardware_concurrency();
+
+    if (thread_count == 0) {
+        thread_count = 1;
+    }
+
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 1; i < thread_count && i < files.size(); ++i) {
+        threads.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<GSCAN> index_scans;
+    std::vector<const char *> index_names;
+
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (found[i]) {
+            index_scans.push_back(scans[i]);
+            index_names.push_back(files[i].c_str());
+        } else {
+            printf("Skipping '%s', no GIMEX module could read its header.\n", files[i].c_str());
+        }
+    }
+
+    GSTREAM stream;
+    stream.fp = fopen(argv[1], "wb");
+
+    if (stream.fp == nullptr) {
+        printf("Failed to open index file '%s' for writing!\n", argv[1]);
+        return -1;
+    }
+
+    bool written = GIMEX_index_write(&stream, index_scans.data(), index_names.data(), int(index_scans.size()));
+    fclose(stream.fp);
+
+    if (!written) {
+        printf("Failed to write index file '%s'!\n", argv[1]);
+        return -1;
+    }
+
+    printf("Indexed %zu of %zu files into '%s'.\n", index_scans.size(), files.size(), argv[1]);
+
+    return 0;
+}
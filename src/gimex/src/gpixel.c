@@ -0,0 +1,201 @@
+/**
+ * @file
+ *
+ * @brief Pixel row helpers shared between GIMEX codecs.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include "gpixel.h"
+#include <cpufeatures.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined _MSC_VER && !defined __clang__
+#include <windows.h>
+#endif
+
+typedef void (*reverse8_func)(uint8_t *, const uint8_t *, int);
+typedef void (*reverse32_func)(uint32_t *, const uint32_t *, int);
+typedef void (*expand8_func)(uint32_t *, const uint8_t *, const uint32_t *, int);
+
+static void GIMEX_reverse8_scalar(uint8_t *dst, const uint8_t *src, int count)
+{
+    const uint8_t *getp = src + count;
+
+    for (int i = 0; i < count; ++i) {
+        *dst++ = *--getp;
+    }
+}
+
+static void GIMEX_reverse32_scalar(uint32_t *dst, const uint32_t *src, int count)
+{
+    const uint32_t *getp = src + count;
+
+    for (int i = 0; i < count; ++i) {
+        *dst++ = *--getp;
+    }
+}
+
+/* Works from the end of the row so that expanding in place never overwrites an index before it is read */
+static void GIMEX_expand8_scalar(uint32_t *dst, const uint8_t *src, const uint32_t *table, int count)
+{
+    for (int i = count - 1; i >= 0; --i) {
+        dst[i] = table[src[i]];
+    }
+}
+
+#ifdef HAVE_X86_SIMD
+__target_attr("ssse3") static void GIMEX_reverse8_ssse3(uint8_t *dst, const uint8_t *src, int count)
+{
+    const __m128i mask = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    int i = 0;
+
+    for (; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + count - i - 16));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(v, mask));
+    }
+
+    GIMEX_reverse8_scalar(dst + i, src, count - i);
+}
+
+__target_attr("avx2") static void GIMEX_reverse8_avx2(uint8_t *dst, const uint8_t *src, int count)
+{
+    /* pshufb only works within 128bit lanes so reverse each lane then swap the lanes over */
+    const __m256i mask = _mm256_broadcastsi128_si256(_mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+    int i = 0;
+
+    for (; i + 32 <= count; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + count - i - 32));
+        v = _mm256_shuffle_epi8(v, mask);
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permute4x64_epi64(v, 0x4E));
+    }
+
+    GIMEX_reverse8_scalar(dst + i, src, count - i);
+}
+
+__target_attr("sse2") static void GIMEX_reverse32_sse2(uint32_t *dst, const uint32_t *src, int count)
+{
+    int i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + count - i - 4));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)));
+    }
+
+    GIMEX_reverse32_scalar(dst + i, src, count - i);
+}
+
+__target_attr("avx2") static void GIMEX_reverse32_avx2(uint32_t *dst, const uint32_t *src, int count)
+{
+    const __m256i mask = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    int i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(src + count - i - 8));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permutevar8x32_epi32(v, mask));
+    }
+
+    GIMEX_reverse32_scalar(dst + i, src, count - i);
+}
+
+__target_attr("avx2") static void GIMEX_expand8_avx2(uint32_t *dst, const uint8_t *src, const uint32_t *table, int count)
+{
+    int i = count;
+
+    /* Each block of indices is loaded before its pixels are stored so expanding in place stays safe */
+    for (; i >= 8; i -= 8) {
+        __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + i - 8)));
+        _mm256_storeu_si256((__m256i *)(dst + i - 8), _mm256_i32gather_epi32((const int *)table, indices, 4));
+    }
+
+    GIMEX_expand8_scalar(dst, src, table, i);
+}
+#endif
+
+/* Kernels are published through atomic loads and stores so threads racing to select them is well defined */
+#if defined _MSC_VER && !defined __clang__
+#define GIMEX_load_kernel(type, kernel) ((type)InterlockedCompareExchangePointer((void *volatile *)&(kernel), NULL, NULL))
+#define GIMEX_store_kernel(kernel, func) InterlockedExchangePointer((void *volatile *)&(kernel), (void *)(func))
+#else
+#define GIMEX_load_kernel(type, kernel) __atomic_load_n(&(kernel), __ATOMIC_ACQUIRE)
+#define GIMEX_store_kernel(kernel, func) __atomic_store_n(&(kernel), (func), __ATOMIC_RELEASE)
+#endif
+
+static reverse8_func gReverse8;
+static reverse32_func gReverse32;
+static expand8_func gExpand8;
+
+/* Selecting more than once only repeats the work, every thread arrives at the same functions */
+static void GIMEX_select_kernels(void)
+{
+    reverse8_func func8 = GIMEX_reverse8_scalar;
+    reverse32_func func32 = GIMEX_reverse32_scalar;
+    expand8_func expand8 = GIMEX_expand8_scalar;
+#ifdef HAVE_X86_SIMD
+    unsigned features = cpu_features();
+
+    if (features & CPU_FEATURE_AVX2) {
+        func8 = GIMEX_reverse8_avx2;
+        func32 = GIMEX_reverse32_avx2;
+        expand8 = GIMEX_expand8_avx2;
+    } else {
+        if (features & CPU_FEATURE_SSSE3) {
+            func8 = GIMEX_reverse8_ssse3;
+        }
+
+        if (features & CPU_FEATURE_SSE2) {
+            func32 = GIMEX_reverse32_sse2;
+        }
+    }
+#endif
+    GIMEX_store_kernel(gExpand8, expand8);
+    GIMEX_store_kernel(gReverse32, func32);
+    GIMEX_store_kernel(gReverse8, func8);
+}
+
+void GIMEX_reverse8(uint8_t *dst, const uint8_t *src, int count)
+{
+    reverse8_func func = GIMEX_load_kernel(reverse8_func, gReverse8);
+
+    if (func == NULL) {
+        GIMEX_select_kernels();
+        func = GIMEX_load_kernel(reverse8_func, gReverse8);
+    }
+
+    func(dst, src, count);
+}
+
+void GIMEX_reverse32(uint32_t *dst, const uint32_t *src, int count)
+{
+    reverse32_func func = GIMEX_load_kernel(reverse32_func, gReverse32);
+
+    if (func == NULL) {
+        GIMEX_select_kernels();
+        func = GIMEX_load_kernel(reverse32_func, gReverse32);
+    }
+
+    func(dst, src, count);
+}
+
+void GIMEX_packpalette(uint32_t *table, const ARGB *colortbl)
+{
+    /* ARGB is laid out to match a native 32bit pixel so packing is a straight copy into aligned storage */
+    memcpy(table, colortbl, sizeof(ARGB) * GIMEX_COLOURTBL_SIZE);
+}
+
+void GIMEX_expand8(uint32_t *dst, const uint8_t *src, const uint32_t *table, int count)
+{
+    expand8_func func = GIMEX_load_kernel(expand8_func, gExpand8);
+
+    if (func == NULL) {
+        GIMEX_select_kernels();
+        func = GIMEX_load_kernel(expand8_func, gExpand8);
+    }
+
+    func(dst, src, table, count);
+}
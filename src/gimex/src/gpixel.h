@@ -0,0 +1,53 @@
+/**
+ * @file
+ *
+ * @brief Pixel row helpers shared between GIMEX codecs.
+ *
+ * @copyright Las Marionetas is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#pragma once
+
+#include <gimex.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Copies a row of 8bit pixels so that the destination is horizontally mirrored.
+ * @param dst Pointer to the destination row, must not overlap src.
+ * @param src Pointer to the source row.
+ * @param count Number of pixels to copy.
+ */
+void GIMEX_reverse8(uint8_t *dst, const uint8_t *src, int count);
+/**
+ * @brief Copies a row of 32bit pixels so that the destination is horizontally mirrored.
+ * @param dst Pointer to the destination row, must not overlap src.
+ * @param src Pointer to the source row.
+ * @param count Number of pixels to copy.
+ */
+void GIMEX_reverse32(uint32_t *dst, const uint32_t *src, int count);
+/**
+ * @brief Packs a GINFO colour table into a lookup table of whole pixels for use with GIMEX_expand8.
+ * @param table Pointer to the 256 entry table to fill.
+ * @param colortbl Pointer to the 256 entry colour table to pack.
+ */
+void GIMEX_packpalette(uint32_t *table, const ARGB *colortbl);
+/**
+ * @brief Expands a row of 8bit palette indices to 32bit ARGB pixels.
+ * @param dst Pointer to the destination row, can be the same address as src to expand in place.
+ * @param src Pointer to the source row of indices.
+ * @param table Pointer to a table filled by GIMEX_packpalette.
+ * @param count Number of pixels to expand.
+ */
+void GIMEX_expand8(uint32_t *dst, const uint8_t *src, const uint32_t *table, int count);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
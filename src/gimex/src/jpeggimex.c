@@ -11,6 +11,7 @@
  *            LICENSE
  */
 #include "jpeggimex.h"
+#include "gpixel.h"
 #include <endianness.h>
 #include <setjmp.h>
 #include <stddef.h>
@@ -305,50 +306,30 @@ void JPG_readline(uint8_t *dst, const uint8_t *src, int width, J_COLOR_SPACE csp
     }
 }
 
-void JPG_writeline(const uint8_t *src, uint8_t *dst, int width, J_COLOR_SPACE cspace, const GINFO *info)
+/* Source rows are always ARGB here, paletted images are expanded with GIMEX_expand8 before reaching this */
+void JPG_writeline(const uint8_t *src, uint8_t *dst, int width, J_COLOR_SPACE cspace)
 {
+    const ARGB *getp = (const ARGB *)src;
+
     switch (cspace) {
         case JCS_GRAYSCALE:
-            if (info->bpp == 32) {
-                for (int i = 0; i < width; ++i) {
-                    dst[i] = ((ARGB *)src)[i].g;
-                }
-            } else {
-                for (int i = 0; i < width; ++i) {
-                    dst[i] = info->colortbl[src[i]].g;
-                }
+            for (int i = 0; i < width; ++i) {
+                dst[i] = getp[i].g;
             }
             break;
         case JCS_RGB:
-            if (info->bpp == 32) {
-                for (int i = 0; i < width; ++i) {
-                    dst[3 * i] = ((ARGB *)src)[i].r;
-                    dst[3 * i + 1] = ((ARGB *)src)[i].g;
-                    dst[3 * i + 2] = ((ARGB *)src)[i].b;
-                }
-            } else {
-                for (int i = 0; i < width; ++i) {
-                    dst[3 * i] = info->colortbl[src[i]].r;
-                    dst[3 * i + 1] = info->colortbl[src[i]].g;
-                    dst[3 * i + 2] = info->colortbl[src[i]].b;
-                }
+            for (int i = 0; i < width; ++i) {
+                dst[3 * i] = getp[i].r;
+                dst[3 * i + 1] = getp[i].g;
+                dst[3 * i + 2] = getp[i].b;
             }
             break;
         case JCS_UNKNOWN:
-            if (info->bpp == 32) {
-                for (int i = 0; i < width; ++i) {
-                    dst[4 * i] = ((ARGB *)src)[i].a;
-                    dst[4 * i + 1] = ((ARGB *)src)[i].r;
-                    dst[4 * i + 2] = ((ARGB *)src)[i].g;
-                    dst[4 * i + 3] = ((ARGB *)src)[i].b;
-                }
-            } else {
-                for (int i = 0; i < width; ++i) {
-                    dst[4 * i] = info->colortbl[src[i]].a;
-                    dst[4 * i + 1] = info->colortbl[src[i]].r;
-                    dst[4 * i + 2] = info->colortbl[src[i]].g;
-                    dst[4 * i + 3] = info->colortbl[src[i]].b;
-                }
+            for (int i = 0; i < width; ++i) {
+                dst[4 * i] = getp[i].a;
+                dst[4 * i + 1] = getp[i].r;
+                dst[4 * i + 2] = getp[i].g;
+                dst[4 * i + 3] = getp[i].b;
             }
             break;
         default:
@@ -514,6 +495,43 @@ GINFO *GIMEX_API JPG_info(GINSTANCE *ctx, int frame)
     return info;
 }
 
+int GIMEX_API JPG_dims(GINSTANCE *ctx, int *width, int *height, int *bpp)
+{
+    struct jpeg_decompress_struct cinfo;
+    struct gimex_error_mgr jerr;
+
+    cinfo.err = jpeg_std_error(&jerr.pub);
+    jerr.pub.error_exit = gimex_error_exit;
+
+    if (setjmp(jerr.setjmp_buffer)) {
+        jpeg_destroy_decompress(&cinfo);
+        return 0;
+    }
+
+    /* Unlike JPG_info we stop after the header, output dimensions don't need the scanlines decoding */
+    jpeg_create_decompress(&cinfo);
+    gseek(ctx->stream, 0);
+    gimex_stream_src(&cinfo, ctx->stream);
+    jpeg_read_header(&cinfo, TRUE);
+    jpeg_calc_output_dimensions(&cinfo);
+
+    if (width != NULL) {
+        *width = cinfo.output_width;
+    }
+
+    if (height != NULL) {
+        *height = cinfo.output_height;
+    }
+
+    if (bpp != NULL) {
+        *bpp = cinfo.output_components == 1 ? 8 : 32;
+    }
+
+    jpeg_destroy_decompress(&cinfo);
+
+    return 1;
+}
+
 int GIMEX_API JPG_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
 {
     struct jpeg_decompress_struct cinfo;
@@ -567,6 +585,8 @@ int GIMEX_API JPG_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
     struct gimex_error_mgr jerr;
     J_COLOR_SPACE cspace;
     JSAMPROW row_buff = NULL;
+    uint32_t *expand_buff = NULL;
+    uint32_t palette[GIMEX_COLOURTBL_SIZE];
     int bytes_per_pixel;
     int quality;
     int width;
@@ -611,6 +631,10 @@ int GIMEX_API JPG_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
             gfree(row_buff);
         }
 
+        if (expand_buff != NULL) {
+            gfree(expand_buff);
+        }
+
         jpeg_destroy_compress(&cinfo);
         return false;
     }
@@ -647,9 +671,28 @@ int GIMEX_API JPG_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
         return false;
     }
 
+    /* Paletted rows are expanded through a packed table once rather than looking up each channel separately */
+    if (info->bpp != 32) {
+        GIMEX_packpalette(palette, info->colortbl);
+        expand_buff = galloc(width * sizeof(uint32_t));
+
+        if (expand_buff == NULL) {
+            gfree(row_buff);
+            jpeg_destroy_compress(&cinfo);
+            return false;
+        }
+    }
+
     for (unsigned i = 0; i < cinfo.image_height; ++i) {
         JSAMPROW row;
-        JPG_writeline((uint8_t *)buffer, row_buff, width, cspace, info);
+
+        if (expand_buff != NULL) {
+            GIMEX_expand8(expand_buff, (uint8_t *)buffer, palette, width);
+            JPG_writeline((uint8_t *)expand_buff, row_buff, width, cspace);
+        } else {
+            JPG_writeline((uint8_t *)buffer, row_buff, width, cspace);
+        }
+
         row = row_buff;
         jpeg_write_scanlines(&cinfo, &row, 1);
         buffer += pitch;
@@ -657,50 +700,61 @@ int GIMEX_API JPG_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
 
     jpeg_finish_compress(&cinfo);
     gfree(row_buff);
+
+    if (expand_buff != NULL) {
+        gfree(expand_buff);
+    }
+
     jpeg_destroy_compress(&cinfo);
 
     return true;
 }
 
+static const GABOUT JPG_aboutinfo = {
+    .signature = GIMEX_ID('J', 'P', 'E', 'G'),
+    .size = sizeof(GABOUT),
+    .version = GIMEX_VERSION,
+    .can_import = 1,
+    .can_export = 1,
+    .import_packed = 1,
+    .export_packed = 1,
+    .import_paletted = 1,
+    .export_paletted = 1,
+    .import_argb = 1,
+    .export_argb = 1,
+    .multi_frame = 0,
+    .multi_file = 0,
+    .multi_size = 1,
+    .requires_frame_buffer = 1,
+    .external = 0,
+    .uses_file = 1,
+    .max_frame_name = 0,
+    .default_quality = 80,
+    .mac_type = { GIMEX_ID('J', 'P', 'E', 'G') },
+    .extensions = { ".jpg", ".jfif" },
+    .author_str = "Assembly Armada",
+    .version_str = "1.00",
+    .short_type = "JPG",
+    .word_type = "JPeg",
+    .long_type = "JPeg",
+};
+
 GABOUT *GIMEX_API JPG_about(void)
 {
     GABOUT *about = galloc(sizeof(GABOUT));
 
     if (about != NULL) {
-        memset(about, 0, sizeof(GABOUT));
-        about->signature = GIMEX_ID('J', 'P', 'E', 'G');
-        about->size = sizeof(GABOUT);
-        about->version = GIMEX_VERSION;
-        about->can_import = 1;
-        about->can_export = 1;
-        about->import_packed = 1;
-        about->export_packed = 1;
-        about->import_paletted = 1;
-        about->export_paletted = 1;
-        about->import_argb = 1;
-        about->export_argb = 1;
-        about->multi_frame = 0;
-        about->multi_file = 0;
-        about->multi_size = 1;
-        about->requires_frame_buffer = 1;
-        about->external = 0;
-        about->uses_file = 1;
-        about->max_frame_name = 0;
-        about->default_quality = 80;
-        about->mac_type[0] = GIMEX_ID('J', 'P', 'E', 'G');
-        strcpy(about->extensions[0], ".jpg");
-        strcpy(about->extensions[1], ".jpeg");
-        strcpy(about->extensions[1], ".jfif");
-        strcpy(about->author_str, "Assembly Armada");
-        strcpy(about->version_str, "1.00");
-        strcpy(about->short_type, "JPG");
-        strcpy(about->word_type, "JPeg");
-        strcpy(about->long_type, "JPeg");
+        memcpy(about, &JPG_aboutinfo, sizeof(GABOUT));
     }
 
     return about;
 }
 
+const GABOUT *GIMEX_API JPG_aboutref(void)
+{
+    return &JPG_aboutinfo;
+}
+
 int GIMEX_API IJL_is(GSTREAM *stream)
 {
     /* Since we won't be linking to the deprecated intel library, IJL funcs are mostly no-op */
@@ -737,6 +791,12 @@ GINFO *GIMEX_API IJL_info(GINSTANCE *ctx, int frame)
     return NULL;
 }
 
+int GIMEX_API IJL_dims(GINSTANCE *ctx, int *width, int *height, int *bpp)
+{
+    GIMEX_NOTIMPLEMENTED();
+    return 0;
+}
+
 int GIMEX_API IJL_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
 {
     GIMEX_NOTIMPLEMENTED();
@@ -749,41 +809,47 @@ int GIMEX_API IJL_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
     return 0;
 }
 
+static const GABOUT IJL_aboutinfo = {
+    .signature = GIMEX_ID('I', 'J', 'P', 'G'),
+    .size = sizeof(GABOUT),
+    .version = GIMEX_VERSION,
+    .can_import = 0,
+    .can_export = 0,
+    .import_packed = 0,
+    .export_packed = 0,
+    .import_paletted = 0,
+    .export_paletted = 0,
+    .import_argb = 0,
+    .export_argb = 0,
+    .multi_frame = 0,
+    .multi_file = 0,
+    .multi_size = 1,
+    .requires_frame_buffer = 1,
+    .external = 0,
+    .uses_file = 1,
+    .max_frame_name = 0,
+    .default_quality = 80,
+    .mac_type = { GIMEX_ID('.', 'j', 'p', 'g') },
+    .extensions = { ".jpg", ".ijl" },
+    .author_str = "Assembly Armada",
+    .version_str = "1.00",
+    .short_type = "ijl",
+    .word_type = "iJPeg",
+    .long_type = "Intel JPeg",
+};
+
 GABOUT *GIMEX_API IJL_about(void)
 {
     GABOUT *about = galloc(sizeof(GABOUT));
 
     if (about != NULL) {
-        memset(about, 0, sizeof(*about));
-        about->signature = GIMEX_ID('I', 'J', 'P', 'G');
-        about->size = sizeof(*about);
-        about->version = 345;
-        about->can_import = 0;
-        about->can_export = 0;
-        about->import_packed = 0;
-        about->export_packed = 0;
-        about->import_paletted = 0;
-        about->export_paletted = 0;
-        about->import_argb = 0;
-        about->export_argb = 0;
-        about->multi_frame = 0;
-        about->multi_file = 0;
-        about->multi_size = 1;
-        about->requires_frame_buffer = 1;
-        about->external = 0;
-        about->uses_file = 1;
-        about->max_frame_name = 0;
-        about->default_quality = 80;
-        about->mac_type[0] = GIMEX_ID('.', 'j', 'p', 'g');
-        strcpy(about->extensions[0], ".jpg");
-        strcpy(about->extensions[1], ".ijpg");
-        strcpy(about->extensions[1], ".ijl");
-        strcpy(about->author_str, "Assembly Armada");
-        strcpy(about->version_str, "1.00");
-        strcpy(about->short_type, "ijl");
-        strcpy(about->word_type, "iJPeg");
-        strcpy(about->long_type, "Intel JPeg");
+        memcpy(about, &IJL_aboutinfo, sizeof(GABOUT));
     }
 
     return about;
 }
+
+const GABOUT *GIMEX_API IJL_aboutref(void)
+{
+    return &IJL_aboutinfo;
+}
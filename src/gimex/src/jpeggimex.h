@@ -26,9 +26,11 @@ int GIMEX_API JPG_close(GINSTANCE *ctx);
 int GIMEX_API JPG_wopen(GINSTANCE **ctx, GSTREAM *stream, const char *unk1, bool unk2);
 int GIMEX_API JPG_wclose(GINSTANCE *ctx);
 GINFO *GIMEX_API JPG_info(GINSTANCE *ctx, int frame);
+int GIMEX_API JPG_dims(GINSTANCE *ctx, int *width, int *height, int *bpp);
 int GIMEX_API JPG_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch);
 int GIMEX_API JPG_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pitch);
 GABOUT *GIMEX_API JPG_about(void);
+const GABOUT *GIMEX_API JPG_aboutref(void);
 
 int GIMEX_API IJL_is(GSTREAM *stream);
 int GIMEX_API IJL_open(GINSTANCE **ctx, GSTREAM *stream, const char *unk1, bool unk2);
@@ -36,9 +38,11 @@ int GIMEX_API IJL_close(GINSTANCE *ctx);
 int GIMEX_API IJL_wopen(GINSTANCE **ctx, GSTREAM *stream, const char *unk1, bool unk2);
 int GIMEX_API IJL_wclose(GINSTANCE *ctx);
 GINFO *GIMEX_API IJL_info(GINSTANCE *ctx, int frame);
+int GIMEX_API IJL_dims(GINSTANCE *ctx, int *width, int *height, int *bpp);
 int GIMEX_API IJL_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch);
 int GIMEX_API IJL_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pitch);
 GABOUT *GIMEX_API IJL_about(void);
+const GABOUT *GIMEX_API IJL_aboutref(void);
 
 #ifdef __cplusplus
 } // extern "C"
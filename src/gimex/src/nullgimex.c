@@ -44,6 +44,11 @@ GINFO *GIMEX_API NULL_info(GINSTANCE *ctx, int frame)
     return NULL;
 }
 
+int GIMEX_API NULL_dims(GINSTANCE *ctx, int *width, int *height, int *bpp)
+{
+    return 0;
+}
+
 int GIMEX_API NULL_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
 {
     return 0;
@@ -54,38 +59,46 @@ int GIMEX_API NULL_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pi
     return 0;
 }
 
+static const GABOUT NULL_aboutinfo = {
+    .signature = GIMEX_ID('N', 'U', 'L', 'L'),
+    .size = sizeof(GABOUT),
+    .version = GIMEX_VERSION,
+    .can_import = 0,
+    .can_export = 0,
+    .import_packed = 0,
+    .export_packed = 0,
+    .import_paletted = 0,
+    .export_paletted = 0,
+    .import_argb = 0,
+    .export_argb = 0,
+    .multi_frame = 0,
+    .multi_file = 0,
+    .multi_size = 1,
+    .requires_frame_buffer = 0,
+    .external = 0,
+    .uses_file = 0,
+    .max_frame_name = 0,
+    .default_quality = 100,
+    .mac_type = { 0 },
+    .author_str = "Assembly Armada",
+    .version_str = "1.00",
+    .short_type = "Null",
+    .word_type = "Not",
+    .long_type = "Not Gimex",
+};
+
 GABOUT *GIMEX_API NULL_about(void)
 {
     GABOUT *about = galloc(sizeof(GABOUT));
 
     if (about != NULL) {
-        memset(about, 0, sizeof(GABOUT));
-        about->signature = GIMEX_ID('N', 'U', 'L', 'L');
-        about->size = sizeof(GABOUT);
-        about->version = GIMEX_VERSION;
-        about->can_import = 0;
-        about->can_export = 0;
-        about->import_packed = 0;
-        about->export_packed = 0;
-        about->import_paletted = 0;
-        about->export_paletted = 0;
-        about->import_argb = 0;
-        about->export_argb = 0;
-        about->multi_frame = 0;
-        about->multi_file = 0;
-        about->multi_size = 1;
-        about->requires_frame_buffer = 0;
-        about->external = 0;
-        about->uses_file = 0;
-        about->max_frame_name = 0;
-        about->default_quality = 100;
-        about->mac_type[0] = 0;
-        strcpy(about->author_str, "Assembly Armada");
-        strcpy(about->version_str, "1.00");
-        strcpy(about->short_type, "Null");
-        strcpy(about->word_type, "Not");
-        strcpy(about->long_type, "Not Gimex");
+        memcpy(about, &NULL_aboutinfo, sizeof(GABOUT));
     }
 
     return about;
 }
+
+const GABOUT *GIMEX_API NULL_aboutref(void)
+{
+    return &NULL_aboutinfo;
+}
@@ -11,6 +11,7 @@
  *            LICENSE
  */
 #include "pnggimex.h"
+#include "gpixel.h"
 #include <png.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -66,7 +67,7 @@ static int PNG_read_gimex(png_structp png_ptr, png_infop info_ptr, GINFO *info,
     rows = galloc(info->height * sizeof(*rows));
 
     if (rows != NULL) {
-        if (info->bpp == 32) {
+        if (info->bpp == 32 && info->original_bpp > 8) {
             size_t row_bytes = png_get_rowbytes(png_ptr, info_ptr);
             png_bytep row_data = galloc(row_bytes * info->height);
 
@@ -116,6 +117,16 @@ static int PNG_read_gimex(png_structp png_ptr, png_infop info_ptr, GINFO *info,
             }
 
             png_read_image(png_ptr, rows);
+
+            /* Caller asked for ARGB from a paletted or grey image, expand the indices in place */
+            if (info->bpp == 32) {
+                uint32_t palette[GIMEX_COLOURTBL_SIZE];
+                GIMEX_packpalette(palette, info->colortbl);
+
+                for (int i = 0; i < info->height; ++i) {
+                    GIMEX_expand8((uint32_t *)rows[i], rows[i], palette, info->width);
+                }
+            }
         }
 
         /* Clean up our pointer array */
@@ -452,6 +463,41 @@ GINFO *GIMEX_API PNG_info(GINSTANCE *ctx, int frame)
     return info;
 }
 
+int GIMEX_API PNG_dims(GINSTANCE *ctx, int *width, int *height, int *bpp)
+{
+    /* Signature, IHDR chunk length and tag followed by the fixed IHDR fields we care about */
+    uint8_t header[26];
+
+    /* IHDR is required to be the first chunk so it can be read straight from the stream without libpng */
+    gseek(ctx->stream, 0);
+
+    if (gread(ctx->stream, header, sizeof(header)) != sizeof(header) || png_sig_cmp(header, 0, 8) != 0
+        || memcmp(&header[12], "IHDR", 4) != 0) {
+        return 0;
+    }
+
+    if (width != NULL) {
+        *width = png_get_uint_32(&header[16]);
+    }
+
+    if (height != NULL) {
+        *height = png_get_uint_32(&header[20]);
+    }
+
+    if (bpp != NULL) {
+        int bit_depth = header[24];
+        int color_type = header[25];
+
+        if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_PALETTE) {
+            *bpp = bit_depth > 8 ? 8 : bit_depth;
+        } else {
+            *bpp = 32;
+        }
+    }
+
+    return 1;
+}
+
 int GIMEX_API PNG_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
 {
     png_structp png_ptr =
@@ -623,39 +669,47 @@ int GIMEX_API PNG_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
     return 0;
 }
 
+static const GABOUT PNG_aboutinfo = {
+    .signature = GIMEX_ID(0, 'P', 'N', 'G'),
+    .size = sizeof(GABOUT),
+    .version = GIMEX_VERSION,
+    .can_import = 1,
+    .can_export = 1,
+    .import_packed = 1,
+    .export_packed = 1,
+    .import_paletted = 1,
+    .export_paletted = 1,
+    .import_argb = 1,
+    .export_argb = 1,
+    .multi_frame = 0,
+    .multi_file = 0,
+    .multi_size = 0,
+    .requires_frame_buffer = 0,
+    .external = 0,
+    .uses_file = 1,
+    .max_frame_name = 0,
+    .default_quality = 100,
+    .mac_type = { GIMEX_ID(0, 'P', 'N', 'G') },
+    .extensions = { ".png" },
+    .author_str = "Assembly Armada",
+    .version_str = "1.00",
+    .short_type = "PNG",
+    .word_type = "PNG",
+    .long_type = "Portable Network Graphics",
+};
+
 GABOUT *GIMEX_API PNG_about(void)
 {
     GABOUT *about = galloc(sizeof(GABOUT));
 
     if (about != NULL) {
-        memset(about, 0, sizeof(GABOUT));
-        about->signature = GIMEX_ID(0, 'P', 'N', 'G');
-        about->size = sizeof(GABOUT);
-        about->version = GIMEX_VERSION;
-        about->can_import = 1;
-        about->can_export = 1;
-        about->import_packed = 1;
-        about->export_packed = 1;
-        about->import_paletted = 1;
-        about->export_paletted = 1;
-        about->import_argb = 1;
-        about->export_argb = 1;
-        about->multi_frame = 0;
-        about->multi_file = 0;
-        about->multi_size = 0;
-        about->requires_frame_buffer = 0;
-        about->external = 0;
-        about->uses_file = 1;
-        about->max_frame_name = 0;
-        about->default_quality = 100;
-        about->mac_type[0] = GIMEX_ID(0, 'P', 'N', 'G');
-        strcpy(about->extensions[0], ".png");
-        strcpy(about->author_str, "Assembly Armada");
-        strcpy(about->version_str, "1.00");
-        strcpy(about->short_type, "PNG");
-        strcpy(about->word_type, "PNG");
-        strcpy(about->long_type, "Portable Network Graphics");
+        memcpy(about, &PNG_aboutinfo, sizeof(GABOUT));
     }
 
     return about;
 }
+
+const GABOUT *GIMEX_API PNG_aboutref(void)
+{
+    return &PNG_aboutinfo;
+}
@@ -26,9 +26,11 @@ int GIMEX_API PNG_close(GINSTANCE *ctx);
 int GIMEX_API PNG_wopen(GINSTANCE **ctx, GSTREAM *stream, const char *unk1, bool unk2);
 int GIMEX_API PNG_wclose(GINSTANCE *ctx);
 GINFO *GIMEX_API PNG_info(GINSTANCE *ctx, int frame);
+int GIMEX_API PNG_dims(GINSTANCE *ctx, int *width, int *height, int *bpp);
 int GIMEX_API PNG_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch);
 int GIMEX_API PNG_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pitch);
 GABOUT *GIMEX_API PNG_about(void);
+const GABOUT *GIMEX_API PNG_aboutref(void);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -74,6 +74,12 @@ GINFO *GIMEX_API FSH_info(GINSTANCE *ctx, int frame)
     return info;
 }
 
+int GIMEX_API FSH_dims(GINSTANCE *ctx, int *width, int *height, int *bpp)
+{
+    GIMEX_NOTIMPLEMENTED();
+    return 0;
+}
+
 int GIMEX_API FSH_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
 {
     GIMEX_NOTIMPLEMENTED();
@@ -86,41 +92,48 @@ int GIMEX_API FSH_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
     return 0;
 }
 
+static const GABOUT FSH_aboutinfo = {
+    .signature = GIMEX_ID('S', 'h', 'p', 'F'),
+    .size = sizeof(GABOUT),
+    .version = GIMEX_VERSION,
+    .can_import = 1,
+    .can_export = 1,
+    .import_packed = 3,
+    .export_packed = 3,
+    .import_paletted = 1,
+    .export_paletted = 1,
+    .import_argb = 1,
+    .export_argb = 1,
+    .multi_frame = 1,
+    .multi_file = 0,
+    .multi_size = 1,
+    .requires_frame_buffer = 1,
+    .external = 0,
+    .uses_file = 1,
+    .mip_maps = 1,
+    .max_frame_name = 504,
+    .default_quality = 75,
+    .mac_type = { GIMEX_ID('.', 'f', 's', 'h') },
+    .extensions = { ".fsh", ".newfsh" },
+    .author_str = "Assembly Armada",
+    .version_str = "1.00",
+    .short_type = "FSH",
+    .word_type = "FSH",
+    .long_type = "PC Shape File",
+};
+
 GABOUT *GIMEX_API FSH_about(void)
 {
     GABOUT *about = galloc(sizeof(GABOUT));
 
     if (about != NULL) {
-        memset(about, 0, sizeof(GABOUT));
-        about->signature = GIMEX_ID('S', 'h', 'p', 'F');
-        about->size = sizeof(GABOUT);
-        about->version = GIMEX_VERSION;
-        about->can_import = 1;
-        about->can_export = 1;
-        about->import_packed = 3;
-        about->export_packed = 3;
-        about->import_paletted = 1;
-        about->export_paletted = 1;
-        about->import_argb = 1;
-        about->export_argb = 1;
-        about->multi_frame = 1;
-        about->multi_file = 0;
-        about->multi_size = 1;
-        about->requires_frame_buffer = 1;
-        about->external = 0;
-        about->uses_file = 1;
-        about->mip_maps = 1;
-        about->max_frame_name = 504;
-        about->default_quality = 75;
-        about->mac_type[0] = GIMEX_ID('.', 'f', 's', 'h');
-        strcpy(about->extensions[0], ".fsh");
-        strcpy(about->extensions[1], ".newfsh");
-        strcpy(about->author_str, "Assembly Armada");
-        strcpy(about->version_str, "1.00");
-        strcpy(about->short_type, "FSH");
-        strcpy(about->word_type, "FSH");
-        strcpy(about->long_type, "PC Shape File");
+        memcpy(about, &FSH_aboutinfo, sizeof(GABOUT));
     }
 
     return about;
 }
+
+const GABOUT *GIMEX_API FSH_aboutref(void)
+{
+    return &FSH_aboutinfo;
+}
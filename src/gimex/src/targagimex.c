@@ -11,45 +11,31 @@
  *            LICENSE
  */
 #include "targagimex.h"
+#include "gpixel.h"
 #include "targa.h"
 #include <endianness.h>
 #include <stddef.h>
 #include <string.h>
 
-static void TGA_flipline(uint8_t *dst, int width, int bpp)
-{
-    if (bpp == 32) {
-        uint32_t *start = (uint32_t *)(dst);
-        uint32_t *end = ((uint32_t *)dst) + width - 1;
-
-        for (int i = 0; i < (width / 2); ++i) {
-            uint32_t tmp = *start;
-            *start++ = *end;
-            *end-- = tmp;
-        }
-    } else {
-        uint8_t *start = dst;
-        uint8_t *end = dst + width - 1;
-
-        for (int i = 0; i < (width / 2); ++i) {
-            uint8_t swapchar = *start;
-            *start++ = *end;
-            *end-- = swapchar;
-        }
-    }
-}
-
-static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *stream)
+/* Decodes a row of image data, writing it mirrored when the image is stored right to left */
+static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *stream, bool flip)
 {
     uint8_t *getp = buffer;
     uint8_t *putp = dst;
     int retval = 0;
     int32_t width = info->width;
     int32_t bpp = info->original_bpp;
+    int32_t step = bpp == 8 ? 1 : 4;
+
+    if (flip) {
+        putp = dst + (width - 1) * step;
+        step = -step;
+    }
 
     if (info->packed) {
         int x = 0;
         int count = 0;
+        int fill = 0;
 
         do {
             retval = gread(stream, getp, 1);
@@ -59,14 +45,17 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
             /* Handle run of repeats */
             if (count & 0x80) {
                 count = (count & 0x7F) + 1;
+                /* Packets that cross the end of the row still consume their data but are clipped to the row */
+                fill = count < width - x ? count : width - x;
                 x += count;
 
                 switch (bpp) {
                     case 8:
                         retval = gread(stream, getp, 1);
 
-                        for (int i = 0; i < count; ++i) {
-                            *putp++ = *getp;
+                        for (int i = 0; i < fill; ++i) {
+                            *putp = *getp;
+                            putp += step;
                         }
 
                         break;
@@ -75,7 +64,7 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
                     case 16:
                         retval = gread(stream, getp, 2);
 
-                        for (int i = 0; i < count; ++i) {
+                        for (int i = 0; i < fill; ++i) {
                             if (info->alpha_bits != 0) {
                                 ((ARGB *)putp)->a = 255 * ((*(getp + 1) >> 7) & 1);
                             } else {
@@ -85,7 +74,7 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
                             ((ARGB *)putp)->r = 255 * ((*(getp + 1) >> 2) & 31) / 31;
                             ((ARGB *)putp)->g = 255 * (((*(getp + 1) & 3) << 3) | ((*(getp + 0) >> 5) & 7)) / 31;
                             ((ARGB *)putp)->b = 255 * (*getp & 31) / 31;
-                            putp += 4;
+                            putp += step;
                         }
 
                         break;
@@ -93,12 +82,12 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
                     case 24:
                         retval = gread(stream, getp, 3);
 
-                        for (int i = 0; i < count; ++i) {
+                        for (int i = 0; i < fill; ++i) {
                             ((ARGB *)putp)->a = 0xFF;
                             ((ARGB *)putp)->r = getp[2];
                             ((ARGB *)putp)->g = getp[1];
                             ((ARGB *)putp)->b = getp[0];
-                            putp += 4;
+                            putp += step;
                         }
 
                         break;
@@ -106,32 +95,34 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
                     case 32:
                         retval = gread(stream, getp, 4);
 
-                        for (int i = 0; i < count; ++i) {
+                        for (int i = 0; i < fill; ++i) {
                             ((ARGB *)putp)->a = getp[3];
                             ((ARGB *)putp)->r = getp[2];
                             ((ARGB *)putp)->g = getp[1];
                             ((ARGB *)putp)->b = getp[0];
-                            putp += 4;
+                            putp += step;
                         }
 
                         break;
                 }
             } else {
                 count = (count & 0x7F) + 1;
+                fill = count < width - x ? count : width - x;
                 x += count;
                 retval = gread(stream, getp, (count * ((bpp + 7) & ~7)) >> 3);
 
                 switch (bpp) {
                     case 8:
-                        for (int i = 0; i < count; ++i) {
-                            *putp++ = *getp++;
+                        for (int i = 0; i < fill; ++i) {
+                            *putp = *getp++;
+                            putp += step;
                         }
 
                         break;
 
                     case 15:
                     case 16:
-                        for (int i = 0; i < count; ++i) {
+                        for (int i = 0; i < fill; ++i) {
                             if (info->alpha_bits != 0) {
                                 ((ARGB *)putp)->a = 255 * ((*(getp + 1) >> 7) & 1);
                             } else {
@@ -141,31 +132,31 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
                             ((ARGB *)putp)->r = 255 * ((*(getp + 1) >> 2) & 31) / 31;
                             ((ARGB *)putp)->g = 255 * (((*(getp + 1) & 3) << 3) | ((*(getp + 0) >> 5) & 7)) / 31;
                             ((ARGB *)putp)->b = 255 * (*getp & 31) / 31;
-                            putp += 4;
+                            putp += step;
                             getp += 2;
                         }
 
                         break;
 
                     case 24:
-                        for (int i = 0; i < count; ++i) {
+                        for (int i = 0; i < fill; ++i) {
                             ((ARGB *)putp)->a = 0xFF;
                             ((ARGB *)putp)->r = getp[2];
                             ((ARGB *)putp)->g = getp[1];
                             ((ARGB *)putp)->b = getp[0];
-                            putp += 4;
+                            putp += step;
                             getp += 3;
                         }
 
                         break;
 
                     case 32:
-                        for (int i = 0; i < count; ++i) {
+                        for (int i = 0; i < fill; ++i) {
                             ((ARGB *)putp)->a = getp[3];
                             ((ARGB *)putp)->r = getp[2];
                             ((ARGB *)putp)->g = getp[1];
                             ((ARGB *)putp)->b = getp[0];
-                            putp += 4;
+                            putp += step;
                             getp += 4;
                         }
 
@@ -178,8 +169,10 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
 
         switch (bpp) {
             case 8:
-                for (int i = 0; i < width; ++i) {
-                    *putp++ = *getp++;
+                if (flip) {
+                    GIMEX_reverse8(dst, getp, width);
+                } else {
+                    memcpy(dst, getp, width);
                 }
 
                 break;
@@ -196,7 +189,7 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
                     ((ARGB *)putp)->r = 255 * ((*(getp + 1) >> 2) & 31) / 31;
                     ((ARGB *)putp)->g = 255 * (((*(getp + 1) & 3) << 3) | ((*(getp + 0) >> 5) & 7)) / 31;
                     ((ARGB *)putp)->b = 255 * (*getp & 31) / 31;
-                    putp += 4;
+                    putp += step;
                     getp += 2;
                 }
 
@@ -208,22 +201,30 @@ static int TGA_readline(GINFO *info, uint8_t *dst, uint8_t *buffer, GSTREAM *str
                     ((ARGB *)putp)->r = getp[2];
                     ((ARGB *)putp)->g = getp[1];
                     ((ARGB *)putp)->b = getp[0];
-                    putp += 4;
+                    putp += step;
                     getp += 3;
                 }
 
                 break;
 
             case 32:
+#if defined __LITTLE_ENDIAN__
+                /* Targa stores BGRA which is already the in memory layout of ARGB */
+                if (flip) {
+                    GIMEX_reverse32((uint32_t *)dst, (const uint32_t *)getp, width);
+                } else {
+                    memcpy(dst, getp, width * sizeof(ARGB));
+                }
+#else
                 for (int i = 0; i < width; ++i) {
                     ((ARGB *)putp)->a = getp[3];
                     ((ARGB *)putp)->r = getp[2];
                     ((ARGB *)putp)->g = getp[1];
                     ((ARGB *)putp)->b = getp[0];
-                    putp += 4;
+                    putp += step;
                     getp += 4;
                 }
-
+#endif
                 break;
         }
     }
@@ -720,6 +721,31 @@ GINFO *GIMEX_API TGA_info(GINSTANCE *ctx, int frame)
     return info;
 }
 
+int GIMEX_API TGA_dims(GINSTANCE *ctx, int *width, int *height, int *bpp)
+{
+    TGAHeader header;
+
+    gseek(ctx->stream, 0);
+
+    if (!gread(ctx->stream, &header, sizeof(header))) {
+        return 0;
+    }
+
+    if (width != NULL) {
+        *width = le16toh(header.width);
+    }
+
+    if (height != NULL) {
+        *height = le16toh(header.height);
+    }
+
+    if (bpp != NULL) {
+        *bpp = header.pixel_depth < 15 ? 8 : 32;
+    }
+
+    return 1;
+}
+
 int GIMEX_API TGA_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
 {
     TGAHeader header;
@@ -734,6 +760,8 @@ int GIMEX_API TGA_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
     int32_t offset = 0;
     int32_t actual_bpp = 0;
     int retval = 0;
+    bool expand = false;
+    uint32_t palette[GIMEX_COLOURTBL_SIZE];
 
     gseek(ctx->stream, 0);
 
@@ -767,15 +795,18 @@ int GIMEX_API TGA_read(GINSTANCE *ctx, GINFO *info, char *buffer, int pitch)
         return 0;
     }
 
+    /* Caller asked for ARGB from a paletted or grey image, expand each row in place while it is still in cache */
+    if (info->bpp == 32 && bpp <= 8) {
+        GIMEX_packpalette(palette, info->colortbl);
+        expand = true;
+    }
+
+    /* Column order is handled while decoding so each row is only written once */
     for (int i = 0; i < height && retval != 0; ++i) {
-        if (i == 123) {
-            offset = 0;
-        }
-        retval = TGA_readline(info, (uint8_t *)putp, line_buffer, ctx->stream);
+        retval = TGA_readline(info, (uint8_t *)putp, line_buffer, ctx->stream, (header.image_descriptor & 0x10) != 0);
 
-        /* Handle column order of the image data */
-        if (header.image_descriptor & 0x10) {
-            TGA_flipline((uint8_t *)putp, width, bpp);
+        if (expand) {
+            GIMEX_expand8((uint32_t *)putp, (uint8_t *)putp, palette, width);
         }
 
         putp += pitch;
@@ -939,42 +970,47 @@ int GIMEX_API TGA_write(GINSTANCE *ctx, const GINFO *info, char *buffer, int pit
     return 0;
 }
 
+static const GABOUT TGA_aboutinfo = {
+    .signature = GIMEX_ID('.', 'T', 'G', 'A'),
+    .size = sizeof(GABOUT),
+    .version = GIMEX_VERSION,
+    .can_import = 1,
+    .can_export = 1,
+    .import_packed = 1,
+    .export_packed = 1,
+    .import_paletted = 1,
+    .export_paletted = 1,
+    .import_argb = 1,
+    .export_argb = 1,
+    .multi_frame = 0,
+    .multi_file = 0,
+    .multi_size = 1,
+    .requires_frame_buffer = 0,
+    .external = 0,
+    .uses_file = 1,
+    .max_frame_name = 0,
+    .default_quality = 100,
+    .mac_type = { GIMEX_ID('T', 'P', 'I', 'C') },
+    .extensions = { ".tga", ".vda", ".icb", ".vst" },
+    .author_str = "Assembly Armada",
+    .version_str = "1.00",
+    .short_type = "TGA",
+    .word_type = "Targa",
+    .long_type = "Targa",
+};
+
 GABOUT *GIMEX_API TGA_about(void)
 {
     GABOUT *about = galloc(sizeof(GABOUT));
 
     if (about != NULL) {
-        memset(about, 0, sizeof(GABOUT));
-        about->signature = GIMEX_ID('.', 'T', 'G', 'A');
-        about->size = sizeof(GABOUT);
-        about->version = GIMEX_VERSION;
-        about->can_import = 1;
-        about->can_export = 1;
-        about->import_packed = 1;
-        about->export_packed = 1;
-        about->import_paletted = 1;
-        about->export_paletted = 1;
-        about->import_argb = 1;
-        about->export_argb = 1;
-        about->multi_frame = 0;
-        about->multi_file = 0;
-        about->multi_size = 1;
-        about->requires_frame_buffer = 0;
-        about->external = 0;
-        about->uses_file = 1;
-        about->max_frame_name = 0;
-        about->default_quality = 100;
-        about->mac_type[0] = GIMEX_ID('T', 'P', 'I', 'C');
-        strcpy(about->extensions[0], ".tga");
-        strcpy(about->extensions[1], ".vda");
-        strcpy(about->extensions[2], ".icb");
-        strcpy(about->extensions[3], ".vst");
-        strcpy(about->author_str, "Assembly Armada");
-        strcpy(about->version_str, "1.00");
-        strcpy(about->short_type, "TGA");
-        strcpy(about->word_type, "Targa");
-        strcpy(about->long_type, "Targa");
+        memcpy(about, &TGA_aboutinfo, sizeof(GABOUT));
     }
 
     return about;
 }
+
+const GABOUT *GIMEX_API TGA_aboutref(void)
+{
+    return &TGA_aboutinfo;
+}
@@ -0,0 +1,119 @@
+#include <bitmapgimex.h>
+#include <gtest/gtest.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace
+{
+// Runs the decoder over a whole buffer of packets, starting from a cleared image so skipped pixels read as 0.
+int DecodeRle(const uint8_t *data, size_t size, uint8_t *image, int width, int height, int bpp)
+{
+    memset(image, 0, width * height);
+
+    return BMP_decoderle(data, data + size, image, width, width, height, bpp);
+}
+} // namespace
+
+TEST(bitmapgimex, unpack1)
+{
+    const uint8_t src[] = { 0xA5, 0xF0 };
+    const uint8_t expected[] = { 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 1, 0xEE };
+    uint8_t dst[12];
+
+    memset(dst, 0xEE, sizeof(dst));
+    BMP_unpack1(dst, src, 11);
+    EXPECT_EQ(memcmp(dst, expected, sizeof(dst)), 0);
+}
+
+TEST(bitmapgimex, unpack4)
+{
+    const uint8_t src[] = { 0x12, 0x34, 0x5F };
+    const uint8_t expected[] = { 1, 2, 3, 4, 5, 0xEE };
+    uint8_t dst[6];
+
+    memset(dst, 0xEE, sizeof(dst));
+    BMP_unpack4(dst, src, 5);
+    EXPECT_EQ(memcmp(dst, expected, sizeof(dst)), 0);
+}
+
+TEST(bitmapgimex, rle8)
+{
+    // Run clipped at the right edge, end of line, absolute run with padding, delta down a row then a clipped run.
+    const uint8_t data[] = { 6, 7, 0, 0, 0, 3, 1, 2, 3, 0, 0, 2, 0, 1, 2, 9, 0, 0, 5, 5 };
+    const uint8_t expected[] = { 7, 7, 7, 7, 1, 2, 3, 0, 0, 0, 0, 9 };
+    uint8_t image[12];
+
+    // Reaching the bottom ends decoding without an end of bitmap, the packet after it is never read.
+    EXPECT_EQ(DecodeRle(data, sizeof(data), image, 4, 3, 8), 1);
+    EXPECT_EQ(memcmp(image, expected, sizeof(image)), 0);
+
+    // Absolute runs past the right edge still consume all their data.
+    const uint8_t clipped[] = { 0, 5, 1, 2, 3, 4, 5, 0, 1, 8, 0, 1 };
+    const uint8_t clipped_expected[] = { 1, 2, 3, 4, 0, 0, 0, 0 };
+    uint8_t clipped_image[8];
+
+    EXPECT_EQ(DecodeRle(clipped, sizeof(clipped), clipped_image, 4, 2, 8), 1);
+    EXPECT_EQ(memcmp(clipped_image, clipped_expected, sizeof(clipped_image)), 0);
+}
+
+TEST(bitmapgimex, rle8_end_of_bitmap)
+{
+    const uint8_t data[] = { 1, 4, 0, 1, 5, 5 };
+    const uint8_t expected[] = { 4, 0, 0, 0, 0, 0, 0, 0 };
+    uint8_t image[8];
+
+    EXPECT_EQ(DecodeRle(data, sizeof(data), image, 4, 2, 8), 1);
+    EXPECT_EQ(memcmp(image, expected, sizeof(image)), 0);
+
+    // A delta past the bottom edge ends decoding, the run after it is never drawn.
+    const uint8_t delta[] = { 1, 3, 0, 2, 0, 5, 4, 6 };
+    const uint8_t delta_expected[] = { 3, 0, 0, 0, 0, 0, 0, 0 };
+
+    EXPECT_EQ(DecodeRle(delta, sizeof(delta), image, 4, 2, 8), 1);
+    EXPECT_EQ(memcmp(image, delta_expected, sizeof(image)), 0);
+}
+
+TEST(bitmapgimex, rle8_bottom_up)
+{
+    const uint8_t data[] = { 4, 1, 0, 0, 4, 2, 0, 1 };
+    const uint8_t expected[] = { 2, 2, 2, 2, 1, 1, 1, 1 };
+    uint8_t image[8];
+
+    memset(image, 0, sizeof(image));
+    EXPECT_EQ(BMP_decoderle(data, data + sizeof(data), image + 4, -4, 4, 2, 8), 1);
+    EXPECT_EQ(memcmp(image, expected, sizeof(image)), 0);
+}
+
+TEST(bitmapgimex, rle8_truncated)
+{
+    uint8_t image[8];
+
+    // Absolute run missing its pixels.
+    const uint8_t absolute[] = { 0, 4, 1, 2 };
+    EXPECT_EQ(DecodeRle(absolute, sizeof(absolute), image, 4, 2, 8), 0);
+
+    // Delta missing its offsets.
+    const uint8_t delta[] = { 0, 2, 1 };
+    EXPECT_EQ(DecodeRle(delta, sizeof(delta), image, 4, 2, 8), 0);
+
+    // Data ending before the image is complete.
+    const uint8_t partial[] = { 2, 1, 0, 0 };
+    const uint8_t expected[] = { 1, 1, 0, 0, 0, 0, 0, 0 };
+    EXPECT_EQ(DecodeRle(partial, sizeof(partial), image, 4, 2, 8), 0);
+    EXPECT_EQ(memcmp(image, expected, sizeof(image)), 0);
+}
+
+TEST(bitmapgimex, rle4)
+{
+    // Run alternating nibbles, end of line, absolute run with padding, then a run clipped at the right edge.
+    const uint8_t data[] = { 5, 0x12, 0, 0, 0, 3, 0xAB, 0xC0, 4, 0x34, 0, 1 };
+    const uint8_t expected[] = { 1, 2, 1, 2, 1, 10, 11, 12, 3, 4 };
+    uint8_t image[10];
+
+    EXPECT_EQ(DecodeRle(data, sizeof(data), image, 5, 2, 4), 1);
+    EXPECT_EQ(memcmp(image, expected, sizeof(image)), 0);
+
+    // Absolute run missing its last byte.
+    const uint8_t truncated[] = { 0, 5, 0x12, 0x34 };
+    EXPECT_EQ(DecodeRle(truncated, sizeof(truncated), image, 5, 2, 4), 0);
+}
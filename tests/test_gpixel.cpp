@@ -0,0 +1,88 @@
+#include <gpixel.h>
+#include <gtest/gtest.h>
+#include <rz/rzrandomsuper.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+namespace
+{
+// Covers empty rows, rows shorter than a vector and lengths either side of each vector width.
+const int kLengths[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 257 };
+} // namespace
+
+TEST(gpixel, reverse8)
+{
+    cRZRandomSuper random(0x8BADF00D);
+
+    for (int count : kLengths) {
+        std::vector<uint8_t> src(count + 1);
+        std::vector<uint8_t> dst(count + 1, 0xEE);
+        std::vector<uint8_t> expected(count + 1, 0xEE);
+
+        for (int i = 0; i < count; ++i) {
+            src[i] = uint8_t(random.RandomUint32Uniform());
+            expected[count - 1 - i] = src[i];
+        }
+
+        GIMEX_reverse8(dst.data(), src.data(), count);
+        EXPECT_EQ(dst, expected) << "count " << count;
+    }
+}
+
+TEST(gpixel, reverse32)
+{
+    cRZRandomSuper random(0x8BADF00D);
+
+    for (int count : kLengths) {
+        std::vector<uint32_t> src(count + 1);
+        std::vector<uint32_t> dst(count + 1, 0xEEEEEEEE);
+        std::vector<uint32_t> expected(count + 1, 0xEEEEEEEE);
+
+        for (int i = 0; i < count; ++i) {
+            src[i] = random.RandomUint32Uniform();
+            expected[count - 1 - i] = src[i];
+        }
+
+        GIMEX_reverse32(dst.data(), src.data(), count);
+        EXPECT_EQ(dst, expected) << "count " << count;
+    }
+}
+
+TEST(gpixel, expand8)
+{
+    cRZRandomSuper random(0x8BADF00D);
+    ARGB colortbl[GIMEX_COLOURTBL_SIZE];
+    uint32_t table[GIMEX_COLOURTBL_SIZE];
+
+    for (int i = 0; i < GIMEX_COLOURTBL_SIZE; ++i) {
+        uint32_t value = random.RandomUint32Uniform();
+        memcpy(&colortbl[i], &value, sizeof(value));
+    }
+
+    GIMEX_packpalette(table, colortbl);
+
+    for (int count : kLengths) {
+        std::vector<uint8_t> src(count + 1);
+        std::vector<uint32_t> dst(count + 1, 0xEEEEEEEE);
+        std::vector<uint32_t> expected(count + 1, 0xEEEEEEEE);
+
+        for (int i = 0; i < count; ++i) {
+            src[i] = uint8_t(random.RandomUint32Uniform());
+            memcpy(&expected[i], &colortbl[src[i]], sizeof(uint32_t));
+        }
+
+        GIMEX_expand8(dst.data(), src.data(), table, count);
+        EXPECT_EQ(dst, expected) << "count " << count;
+
+        // Expanding in place starts with the indices packed at the front of the row the pixels are written to.
+        std::vector<uint32_t> row(count + 1, 0xEEEEEEEE);
+
+        if (count != 0) {
+            memcpy(row.data(), src.data(), count);
+        }
+
+        GIMEX_expand8(row.data(), reinterpret_cast<const uint8_t *>(row.data()), table, count);
+        EXPECT_EQ(row, expected) << "in place count " << count;
+    }
+}
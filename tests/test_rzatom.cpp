@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include <rz/rzatom.h>
+#include <rz/rzstring.h>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+TEST(atom, intern)
+{
+    cRZAtom path("Textures/Terrain/Grass.png");
+    cRZAtom same(cRZString("Textures/Terrain/Grass.png"));
+    cRZAtom lower("textures/terrain/grass.png");
+
+    EXPECT_EQ(path, same);
+    EXPECT_NE(path, lower);
+    EXPECT_EQ(path.Folded(), lower);
+    EXPECT_EQ(lower.Folded(), lower);
+    EXPECT_TRUE(path.IsEqual(lower, false));
+    EXPECT_FALSE(path.IsEqual(lower, true));
+    EXPECT_STREQ(path.ToChar(), "Textures/Terrain/Grass.png");
+    EXPECT_EQ(path.Strlen(), 26u);
+    EXPECT_NE(path.Hash(), lower.Hash());
+
+    EXPECT_TRUE(cRZAtom("").IsEmpty());
+    EXPECT_STREQ(cRZAtom().ToChar(), "");
+    EXPECT_EQ(cRZAtom::Find("Textures/Terrain/Grass.png", 26), path);
+    EXPECT_TRUE(cRZAtom::Find("Never/Interned", 14).IsEmpty());
+}
+
+TEST(atom, threads)
+{
+    const int thread_count = 4;
+    const int name_count = 5000;
+    std::vector<uint32_t> ids[thread_count];
+    std::vector<std::thread> threads;
+
+    // Every thread interns the same names, they must all agree on the atoms.
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            char name[32];
+
+            for (int i = 0; i < name_count; ++i) {
+                snprintf(name, sizeof(name), "Object_%d", i);
+                ids[t].push_back(cRZAtom(name).ID());
+            }
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 1; t < thread_count; ++t) {
+        EXPECT_EQ(ids[t], ids[0]);
+    }
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <rz/rzcriticalsection.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(criticalsection, recursion)
+{
+    cRZCriticalSection cs;
+
+    EXPECT_EQ(cs.IsLocked(), 0);
+    EXPECT_EQ(cs.Lock(), 1);
+    EXPECT_EQ(cs.Lock(), 2);
+    EXPECT_EQ(cs.TryLock(), 3);
+    EXPECT_EQ(cs.IsLocked(), 3);
+    EXPECT_EQ(cs.Unlock(), 2);
+    EXPECT_EQ(cs.Unlock(), 1);
+    EXPECT_EQ(cs.Unlock(), 0);
+    EXPECT_EQ(cs.IsLocked(), 0);
+}
+
+TEST(criticalsection, exclusion)
+{
+    cRZCriticalSection cs;
+    int32_t other_try = -1;
+
+    cs.Lock();
+    std::thread([&]() { other_try = cs.TryLock(); }).join();
+    EXPECT_EQ(other_try, 0);
+    cs.Unlock();
+
+    const int thread_count = 4;
+    const int iterations = 50000;
+    int counter = 0;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < iterations; ++j) {
+                cRZLock lock(cs);
+                ++counter;
+            }
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter, thread_count * iterations);
+    EXPECT_EQ(cs.IsLocked(), 0);
+}
+
+TEST(criticalsection, contention)
+{
+    cRZCriticalSection cs;
+    std::atomic<bool> entered(false);
+
+    EXPECT_EQ(cs.GetContentionCount(), 0u);
+    cs.Lock();
+
+    std::thread waiter([&]() {
+        cs.Lock();
+        entered = true;
+        cs.Unlock();
+    });
+
+    // Waits for the other thread to block on the lock, giving up eventually so a failure can't hang the test.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (cs.GetContentionCount() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+
+    EXPECT_FALSE(entered);
+    cs.Unlock();
+    waiter.join();
+
+    EXPECT_TRUE(entered);
+    EXPECT_EQ(cs.GetContentionCount(), 1u);
+}
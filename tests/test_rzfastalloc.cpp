@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <rz/rzfastalloc.h>
+#include <stdint.h>
+#include <string.h>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(fastalloc, alloc_free)
+{
+    std::vector<uint8_t *> blocks;
+
+    // Cover every small size class and a few sizes that go to the system heap.
+    for (size_t size = 0; size <= 300; ++size) {
+        uint8_t *block = static_cast<uint8_t *>(RZFastAlloc(size));
+        ASSERT_NE(block, nullptr);
+        EXPECT_EQ(uintptr_t(block) % 16, 0u);
+        memset(block, int(size & 0xFF), size);
+        blocks.push_back(block);
+    }
+
+    for (size_t size = 0; size < blocks.size(); ++size) {
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_EQ(blocks[size][i], uint8_t(size & 0xFF));
+        }
+
+        RZFastFree(blocks[size]);
+    }
+
+    RZFastFree(nullptr);
+}
+
+TEST(fastalloc, realloc)
+{
+    uint8_t *block = static_cast<uint8_t *>(RZFastRealloc(nullptr, 8));
+    ASSERT_NE(block, nullptr);
+
+    for (int i = 0; i < 8; ++i) {
+        block[i] = uint8_t(i);
+    }
+
+    // Growing within the size class keeps the block where it is.
+    EXPECT_EQ(RZFastRealloc(block, 16), block);
+
+    // Growing across classes and out to the system heap must preserve the contents.
+    for (size_t size = 32; size <= 1024; size *= 2) {
+        block = static_cast<uint8_t *>(RZFastRealloc(block, size));
+        ASSERT_NE(block, nullptr);
+
+        for (int i = 0; i < 8; ++i) {
+            ASSERT_EQ(block[i], uint8_t(i));
+        }
+    }
+
+    block = static_cast<uint8_t *>(RZFastRealloc(block, 4));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(block[i], uint8_t(i));
+    }
+
+    RZFastFree(block);
+}
+
+TEST(fastalloc, threads)
+{
+    const int thread_count = 4;
+    const int block_count = 10000;
+    std::vector<void *> handoff[thread_count];
+    std::vector<std::thread> threads;
+
+    // Each thread frees its neighbour's blocks so memory moves between thread caches.
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < block_count; ++i) {
+                size_t size = size_t(i % 256) + 1;
+                uint8_t *block = static_cast<uint8_t *>(RZFastAlloc(size));
+                block[0] = uint8_t(t);
+                block[size - 1] = uint8_t(t);
+                handoff[t].push_back(block);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    threads.clear();
+
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<void *> &blocks = handoff[(t + 1) % thread_count];
+
+            for (int i = 0; i < block_count; ++i) {
+                uint8_t *block = static_cast<uint8_t *>(blocks[i]);
+                EXPECT_EQ(block[0], uint8_t((t + 1) % thread_count));
+                EXPECT_EQ(block[i % 256], uint8_t((t + 1) % thread_count));
+                RZFastFree(block);
+            }
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+}
+
+TEST(fastalloc, sized_free)
+{
+    // A system heap block shrunk into the small range must move so that a sized free can trust the size.
+    uint8_t *block = static_cast<uint8_t *>(RZFastAlloc(1000));
+    block[0] = 0x55;
+    block = static_cast<uint8_t *>(RZFastRealloc(block, 100));
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ(block[0], 0x55);
+    RZFastFreeSized(block, 100);
+    RZFastFreeSized(RZFastAlloc(4000), 4000);
+
+    typedef std::basic_string<char, std::char_traits<char>, cRZFastSTLAllocator<char>> fast_string;
+    std::list<fast_string, cRZFastSTLAllocator<fast_string>> strings;
+
+    for (int i = 0; i < 100; ++i) {
+        strings.emplace_back(size_t(i * 7), char('a' + i % 26));
+    }
+
+    std::list<fast_string, cRZFastSTLAllocator<fast_string>> moved(std::move(strings));
+    EXPECT_EQ(moved.size(), 100u);
+    EXPECT_EQ(moved.back(), fast_string(99 * 7, char('a' + 99 % 26)));
+}
+
+static void CountSample(void *pvMem, size_t nCount, void *const *ppFrames, int nFrames, void *pContext)
+{
+    std::vector<void *> *samples = static_cast<std::vector<void *> *>(pContext);
+    samples->push_back(pvMem);
+}
+
+TEST(fastalloc, tracking)
+{
+    RZFastAllocStats before;
+    RZFastAllocStats after;
+    RZFastAllocStats diff;
+
+    RZFastAllocSetTracking(true, 1);
+    ASSERT_TRUE(RZFastAllocGetStats(before));
+
+    void *small[3];
+
+    for (int i = 0; i < 3; ++i) {
+        small[i] = RZFastAlloc(24);
+    }
+
+    void *large = RZFastAlloc(1000);
+
+    RZFastAllocGetStats(after);
+    RZFastAllocDiffStats(before, after, diff);
+
+    EXPECT_EQ(diff.mClasses[1].mnAllocCount, 3u);
+    EXPECT_EQ(diff.mClasses[1].mnBytesInUse, 96);
+    EXPECT_EQ(diff.mClasses[kRZFastAllocSmallClasses].mnAllocCount, 1u);
+    EXPECT_GE(diff.mClasses[kRZFastAllocSmallClasses].mnBytesInUse, 1000);
+    EXPECT_GE(after.mnPeakBytes, after.mnBytesInUse);
+
+    std::vector<void *> samples;
+    RZFastAllocEnumSamples(CountSample, &samples);
+    EXPECT_EQ(samples.size(), 4u);
+
+    for (int i = 0; i < 3; ++i) {
+        RZFastFree(small[i]);
+    }
+
+    RZFastFree(large);
+
+    RZFastAllocGetStats(after);
+    RZFastAllocDiffStats(before, after, diff);
+    RZFastAllocSetTracking(false);
+
+    EXPECT_EQ(diff.mnBytesInUse, 0);
+    EXPECT_EQ(diff.mClasses[1].mnFreeCount, 3u);
+    EXPECT_EQ(RZFastAllocEnumSamples(CountSample, &samples), 0u);
+}
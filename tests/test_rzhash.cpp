@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <rz/rzhash.h>
+#include <rz/rzstring.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+TEST(hash, case_folding)
+{
+    std::string mixed;
+    std::string lower;
+
+    // Lengths cover every read size the hash uses, including the 48 byte lanes.
+    for (int i = 0; i < 130; ++i) {
+        char c = char("aBcDeFgHiJkLmNoPqRsTuVwXyZ@[`{/_09"[i % 34]);
+        mixed += c;
+        lower += char(RZFoldCase((unsigned char)c));
+
+        EXPECT_EQ(RZCaseHash64(mixed.data(), mixed.size()), RZHash64(lower.data(), lower.size()));
+        EXPECT_EQ(RZCaseHash64(lower.data(), lower.size()), RZHash64(lower.data(), lower.size()));
+    }
+
+    std::unordered_set<uint64_t> hashes;
+
+    for (size_t i = 0; i <= mixed.size(); ++i) {
+        hashes.insert(RZHash64(mixed.data(), i));
+    }
+
+    EXPECT_EQ(hashes.size(), mixed.size() + 1);
+    EXPECT_NE(RZHash64("abc", 3, 0), RZHash64("abc", 3, 1));
+}
+
+TEST(hash, containers)
+{
+    std::unordered_map<cRZString, int> exact;
+    exact[cRZString("Textures/Grass.png")] = 1;
+    exact[cRZString("textures/grass.png")] = 2;
+    EXPECT_EQ(exact.size(), 2u);
+
+    std::unordered_map<cRZString, int, cRZStringCaseHash, cRZStringCaseEqual> folded;
+    folded[cRZString("Textures/Grass.png")] = 1;
+    folded[cRZString("TEXTURES/GRASS.PNG")] = 2;
+    EXPECT_EQ(folded.size(), 1u);
+    EXPECT_EQ(folded[cRZString("textures/grass.png")], 2);
+
+    std::unordered_map<cRZHashedString, int> keys;
+    keys[cRZHashedString(cRZString("Models/House.obj"), false)] = 3;
+    EXPECT_EQ(keys.count(cRZHashedString(cRZString("models/house.OBJ"), false)), 1u);
+    EXPECT_EQ(keys.count(cRZHashedString(cRZString("models/house.OBJ"))), 0u);
+}
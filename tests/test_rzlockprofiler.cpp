@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <rz/rzcriticalsection.h>
+#include <rz/rzlockprofiler.h>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+RZLockProfileStats Named(const char *name)
+{
+    RZLockProfileStats stats = {};
+    stats.mpName = name;
+    return stats;
+}
+
+void FindStats(const RZLockProfileStats &stats, void *context)
+{
+    RZLockProfileStats *found = static_cast<RZLockProfileStats *>(context);
+
+    if (std::strcmp(stats.mpName, found->mpName) == 0) {
+        *found = stats;
+    }
+}
+} // namespace
+
+#ifdef RZ_LOCK_PROFILING
+TEST(lockprofiler, statistics)
+{
+    cRZCriticalSection cs;
+    cs.SetName("test_lockprofiler");
+    RZLockProfileReset();
+
+    cs.Lock();
+    cs.Lock();
+    cs.Unlock();
+    cs.Unlock();
+
+    RZLockProfileStats stats = Named("test_lockprofiler");
+    RZLockProfileEnum(FindStats, &stats);
+    EXPECT_EQ(stats.mnAcquireCount, 1u);
+    EXPECT_EQ(stats.mnContendedCount, 0u);
+
+    cs.Lock();
+    std::thread other([&]() {
+        cs.Lock();
+        cs.Unlock();
+    });
+
+    while (cs.GetContentionCount() == 0) {
+        std::this_thread::yield();
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    cs.Unlock();
+    other.join();
+
+    stats = Named("test_lockprofiler");
+    RZLockProfileEnum(FindStats, &stats);
+    EXPECT_EQ(stats.mnAcquireCount, 3u);
+    EXPECT_EQ(stats.mnContendedCount, 1u);
+    EXPECT_GT(stats.mnWaitTime, 0u);
+    EXPECT_GE(stats.mnMaxHoldTime, 5000000u);
+
+    RZLockProfileReset();
+    stats = Named("test_lockprofiler");
+    RZLockProfileEnum(FindStats, &stats);
+    EXPECT_EQ(stats.mnAcquireCount, 0u);
+}
+#else
+TEST(lockprofiler, disabled)
+{
+    cRZCriticalSection cs;
+    cs.SetName("test_lockprofiler");
+    cs.Lock();
+    cs.Unlock();
+
+    RZLockProfileStats stats = Named("test_lockprofiler");
+    RZLockProfileEnum(FindStats, &stats);
+    EXPECT_EQ(stats.mnAcquireCount, 0u);
+    EXPECT_FALSE(RZLockProfilePeriodicDump(stdout, 0));
+}
+#endif
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 #include <rz/rzrandom.h>
 #include <rzrandomsuper.h>
+#include <cmath>
 #include <stdint.h>
+#include <vector>
 
 TEST(random, lcg_rng)
 {
@@ -166,3 +168,306 @@ TEST(random, mersenne_rng)
         EXPECT_DOUBLE_EQ(rng.RandomDoubleRangeUniform(i - 1000, i * 1000), SuperRandomDoubleRangeUniform_data[i]);
     }
 }
+
+TEST(random, mersenne_reload)
+{
+    // Values from the last word of several reloads, generated before the reload was vectorised.
+    cRZRandomSuper rng(0xDEADBEEF);
+    uint32_t values[5000];
+
+    for (int i = 0; i < 5000; ++i) {
+        values[i] = rng.RandomUint32Uniform();
+    }
+
+    EXPECT_EQ(values[623], 0x6f58ecf0u);
+    EXPECT_EQ(values[624], 0xf81e936eu);
+    EXPECT_EQ(values[1247], 0xd3bd016au);
+    EXPECT_EQ(values[1248], 0xab2731e3u);
+    EXPECT_EQ(values[4999], 0x6825704du);
+}
+
+TEST(random, mersenne_reload_seeds)
+{
+    // Last value produced from each of the first 10 reloads for a few seeds, generated before the reload was vectorised.
+    uint32_t seeds[] = { 1, 0x12345678, 0xCAFEF00D };
+    uint32_t expected[][10] = {
+        { 0xd271d3d5, 0x0dda6bb4, 0xead64522, 0xfc75ca20, 0x97f95a20,
+          0x364d4792, 0xf5261dee, 0xcd28e570, 0x71bf9c22, 0xda70475e },
+        { 0x3e81f911, 0x697252b6, 0xd7dcd957, 0x4e0ed726, 0x2034e2ef,
+          0xf6e5d0d5, 0x0d892e4e, 0x6b2b0f33, 0xc7837c22, 0xb575b9c1 },
+        { 0x57e9c3d6, 0x6991acaf, 0x8d99be36, 0x7b12be4e, 0x7d715f2b,
+          0x01f7e08f, 0xd1ad5577, 0x3383a7cd, 0x5c32a560, 0xd7a8dfcd },
+    };
+
+    for (int i = 0; i < 3; ++i) {
+        cRZRandomSuper rng(seeds[i]);
+        uint32_t values[cRZRandomSuper::TWIST_SIZE];
+
+        for (int j = 0; j < 10; ++j) {
+            rng.Fill(values, cRZRandomSuper::TWIST_SIZE);
+            EXPECT_EQ(values[cRZRandomSuper::TWIST_SIZE - 1], expected[i][j]);
+        }
+    }
+}
+
+TEST(random, mersenne_fill)
+{
+    cRZRandomSuper scalar(0xDEADBEEF);
+    cRZRandomSuper bulk(0xDEADBEEF);
+    uint32_t values[2000];
+
+    // Start part way through the twister state so blocks straddle a reload.
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(bulk.RandomUint32Uniform(), scalar.RandomUint32Uniform());
+    }
+
+    bulk.Fill(values, 2000);
+
+    for (int i = 0; i < 2000; ++i) {
+        EXPECT_EQ(values[i], scalar.RandomUint32Uniform());
+    }
+
+    int32_t ranges[1000];
+    bulk.FillRange(ranges, 1000, -1000, 5000);
+
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(ranges[i], scalar.RandomSint32RangeUniform(-1000, 5000));
+    }
+
+    double doubles[1000];
+    bulk.FillDoubles(doubles, 1000);
+
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(doubles[i], scalar.RandomDoubleUniform());
+    }
+
+    bulk.FillDoubles(doubles, 1000, -10.0, 10.0);
+
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(doubles[i], scalar.RandomDoubleRangeUniform(-10.0, 10.0));
+    }
+
+    EXPECT_EQ(bulk.RandomUint32Uniform(), scalar.RandomUint32Uniform());
+}
+
+TEST(random, lcg_jump)
+{
+    cRZRandom stepped(0xDEADBEEF);
+    cRZRandom jumped(0xDEADBEEF);
+
+    for (int i = 0; i < 1000; ++i) {
+        stepped.RandomUint32Uniform();
+        stepped.RandomDoubleUniform();
+    }
+
+    jumped.Jump(1000);
+    EXPECT_EQ(jumped.RandomUint32Uniform(), stepped.RandomUint32Uniform());
+    EXPECT_EQ(jumped.RandomDoubleUniform(), stepped.RandomDoubleUniform());
+
+    cRZRandom parent(0x12345678);
+    cRZRandom reference(0x12345678);
+    cRZRandom child = parent.Split();
+
+    for (int i = 0; i < cRZRandom::SPLIT_STRIDE; ++i) {
+        ASSERT_EQ(child.RandomUint32Uniform(), reference.RandomUint32Uniform());
+    }
+
+    // The parent picks up exactly where the stream handed to the child ends.
+    EXPECT_EQ(parent.RandomUint32Uniform(), reference.RandomUint32Uniform());
+}
+
+TEST(random, mersenne_jump)
+{
+    cRZRandomSuper parent(0xDEADBEEF);
+    cRZRandomSuper reference(0xDEADBEEF);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(parent.RandomUint32Uniform(), reference.RandomUint32Uniform());
+    }
+
+    cRZRandomSuper child = parent.Split();
+
+    for (int i = 0; i < 2000; ++i) {
+        EXPECT_EQ(child.RandomUint32Uniform(), reference.RandomUint32Uniform());
+    }
+
+    // Generated by evaluating the jump polynomial independently of cRZRandomSuper.
+    EXPECT_EQ(parent.RandomUint32Uniform(), 0xdcb84fc5u);
+    EXPECT_EQ(parent.RandomUint32Uniform(), 0xe8e740f3u);
+}
+
+TEST(random, mersenne_jump_polynomial)
+{
+    const int words = cRZRandomSuper::RELOAD_POLYNOMIAL_DEGREE / 32;
+    std::vector<uint32_t> jump(words, 0);
+    jump[0] = 1;
+
+    // x^(2^16) modulo the reload polynomial, built by multiplying by x one degree at a time.
+    for (int i = 0; i < 65536; ++i) {
+        uint32_t carry = 0;
+
+        for (int w = 0; w < words; ++w) {
+            uint32_t next = jump[w] >> 31;
+            jump[w] = (jump[w] << 1) | carry;
+            carry = next;
+        }
+
+        if (carry != 0) {
+            for (int w = 0; w < words; ++w) {
+                jump[w] ^= kRZReloadPolynomial[w];
+            }
+        }
+    }
+
+    const uint32_t seeds[] = { 0xDEADBEEF, 1, 0xCAFEF00D };
+    std::vector<uint32_t> skipped(cRZRandomSuper::TWIST_SIZE);
+
+    for (uint32_t seed : seeds) {
+        cRZRandomSuper jumped(seed);
+        cRZRandomSuper reference(seed);
+        jumped.Jump(jump.data(), cRZRandomSuper::RELOAD_POLYNOMIAL_DEGREE);
+
+        for (int i = 0; i < 65536; ++i) {
+            reference.Fill(skipped.data(), cRZRandomSuper::TWIST_SIZE);
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(jumped.RandomUint32Uniform(), reference.RandomUint32Uniform());
+        }
+    }
+
+    // Evaluating the reload polynomial itself must reduce any state to zero.
+    cRZRandomSuper zeroed(0x12345678);
+    zeroed.Jump(kRZReloadPolynomial, cRZRandomSuper::RELOAD_POLYNOMIAL_DEGREE + 1);
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(zeroed.RandomUint32Uniform(), 0u);
+    }
+}
+
+TEST(random, mersenne_jump_count)
+{
+    cRZRandomSuper jumped(0xDEADBEEF);
+    cRZRandomSuper reference(0xDEADBEEF);
+    jumped.Jump(uint32_t(5));
+
+    for (int i = 0; i < 5; ++i) {
+        reference.Jump();
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(jumped.RandomUint32Uniform(), reference.RandomUint32Uniform());
+    }
+}
+
+TEST(random, bounded)
+{
+    cRZRandom lcg(0xDEADBEEF);
+    cRZRandom lcg_reference(0xDEADBEEF);
+    cRZRandomSuper mersenne(0xDEADBEEF);
+    cRZRandomSuper mersenne_reference(0xDEADBEEF);
+
+    // Powers of two never reject so they are just the top bits of a single draw.
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(lcg.RandomUint32Bounded(16), lcg_reference.RandomUint32Uniform() >> 28);
+        EXPECT_EQ(mersenne.RandomUint32Bounded(16), mersenne_reference.RandomUint32Uniform() >> 28);
+    }
+
+    EXPECT_EQ(mersenne.RandomUint32Bounded(0), 0u);
+    EXPECT_EQ(mersenne.RandomUint32Bounded(1), 0u);
+
+    int counts[6] = {};
+
+    for (int i = 0; i < 60000; ++i) {
+        uint32_t value = mersenne.RandomUint32Bounded(6);
+        ASSERT_LT(value, 6u);
+        ++counts[value];
+    }
+
+    for (int i = 0; i < 6; ++i) {
+        EXPECT_NEAR(counts[i], 10000, 600);
+    }
+}
+
+TEST(random, double53)
+{
+    cRZRandom lcg(0x12345678);
+    cRZRandom lcg_reference(0x12345678);
+    cRZRandomSuper mersenne(0x12345678);
+    cRZRandomSuper mersenne_reference(0x12345678);
+
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t high = lcg_reference.RandomUint32Uniform() >> 5;
+        uint32_t low = lcg_reference.RandomUint32Uniform() >> 6;
+        double value = lcg.RandomDouble53();
+        EXPECT_EQ(value, (high * 67108864.0 + low) / 9007199254740992.0);
+        EXPECT_GE(value, 0.0);
+        EXPECT_LT(value, 1.0);
+
+        high = mersenne_reference.RandomUint32Uniform() >> 5;
+        low = mersenne_reference.RandomUint32Uniform() >> 6;
+        EXPECT_EQ(mersenne.RandomDouble53(), (high * 67108864.0 + low) / 9007199254740992.0);
+    }
+}
+
+TEST(random, ziggurat)
+{
+    const int count = 200000;
+    std::vector<double> values(count);
+    cRZRandomSuper rng(0xDEADBEEF);
+
+    rng.FillGaussian(values.data(), count, 2.0, 3.0);
+    double sum = 0.0;
+    double sum_sq = 0.0;
+
+    for (double value : values) {
+        sum += value;
+        sum_sq += value * value;
+    }
+
+    double mean = sum / count;
+    EXPECT_NEAR(mean, 2.0, 0.03);
+    EXPECT_NEAR(std::sqrt(sum_sq / count - mean * mean), 3.0, 0.03);
+
+    rng.FillExponential(values.data(), count, 4.0);
+    sum = 0.0;
+
+    for (double value : values) {
+        ASSERT_GE(value, 0.0);
+        sum += value;
+    }
+
+    EXPECT_NEAR(sum / count, 0.25, 0.005);
+
+    // Same seed gives the same samples.
+    cRZRandomSuper first(42);
+    cRZRandomSuper second(42);
+    double a[100];
+    double b[100];
+    first.FillGaussian(a, 100);
+    second.FillGaussian(b, 100);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(a[i], b[i]);
+    }
+}
+
+TEST(random, ziggurat_consumption)
+{
+    // A single sample only uses a handful of values, the generator must continue straight after them.
+    for (uint32_t seed = 1; seed <= 20; ++seed) {
+        cRZRandomSuper rng(seed);
+        double sample;
+        rng.FillGaussian(&sample, 1);
+        uint32_t next = rng.RandomUint32Uniform();
+
+        cRZRandomSuper reference(seed);
+        int used = 0;
+
+        while (used < 16 && reference.RandomUint32Uniform() != next) {
+            ++used;
+        }
+
+        EXPECT_LT(used, 16);
+    }
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <rz/rzrandomservice.h>
+#include <thread>
+
+TEST(randomservice, master_seed)
+{
+    RZSetMasterRandomSeed(1234);
+    EXPECT_EQ(RZGetMasterRandomSeed(), 1234u);
+
+    // The first thread to draw after seeding gets the start of the master sequence.
+    cRZRandomSuper reference(1234);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(RZThreadRandom().RandomUint32Uniform(), reference.RandomUint32Uniform());
+    }
+
+    cRZRandomHandle handle;
+    EXPECT_EQ(handle->RandomUint32Uniform(), reference.RandomUint32Uniform());
+    EXPECT_EQ((*handle).RandomUint32Uniform(), reference.RandomUint32Uniform());
+
+    RZSetMasterRandomSeed(UINT32_MAX);
+    EXPECT_NE(RZGetMasterRandomSeed(), UINT32_MAX);
+}
+
+TEST(randomservice, thread_streams)
+{
+    RZSetMasterRandomSeed(5678);
+    uint32_t first = RZThreadRandom().RandomUint32Uniform();
+    uint32_t values[100];
+
+    std::thread worker([&values]() {
+        for (int i = 0; i < 100; ++i) {
+            values[i] = RZThreadRandom().RandomUint32Uniform();
+        }
+    });
+
+    worker.join();
+
+    // The second thread to draw gets the stream one jump along from the first.
+    cRZRandomSuper reference(5678);
+    EXPECT_EQ(first, reference.RandomUint32Uniform());
+    reference.Seed(5678);
+    reference.Jump();
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(values[i], reference.RandomUint32Uniform());
+    }
+}
+
+TEST(randomservice, service)
+{
+    cRZRandomService *service = new cRZRandomService;
+    cIGZRandomService *random = nullptr;
+
+    ASSERT_TRUE(service->QueryInterface(GZIID_cIGZRandomService, reinterpret_cast<void **>(&random)));
+    EXPECT_EQ(random->GetServiceID(), kRZSRVID_cRZRandomService);
+
+    random->SetMasterSeed(42);
+    EXPECT_EQ(random->GetMasterSeed(), 42u);
+
+    cRZRandomSuper reference(42);
+    EXPECT_EQ(random->RandomUint32Uniform(), reference.RandomUint32Uniform());
+    EXPECT_EQ(random->RandomSint32RangeUniform(-10, 10), reference.RandomSint32RangeUniform(-10, 10));
+
+    random->Release();
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <rz/rzreadwritelock.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(readwritelock, shared_readers)
+{
+    cRZReadWriteLock lock;
+    bool other_read = false;
+    bool other_write = true;
+
+    lock.LockRead();
+    std::thread([&]() {
+        other_read = lock.TryLockRead();
+
+        if (other_read) {
+            lock.UnlockRead();
+        }
+
+        other_write = lock.TryLockWrite();
+    }).join();
+    lock.UnlockRead();
+
+    EXPECT_TRUE(other_read);
+    EXPECT_FALSE(other_write);
+
+    EXPECT_TRUE(lock.TryLockWrite());
+    std::thread([&]() { other_read = lock.TryLockRead(); }).join();
+    EXPECT_FALSE(other_read);
+    lock.UnlockWrite();
+}
+
+TEST(readwritelock, writer_preference)
+{
+    cRZReadWriteLock lock;
+    std::atomic<bool> written(false);
+
+    lock.LockRead();
+
+    std::thread writer([&]() {
+        cRZWriteLock guard(lock);
+        written = true;
+    });
+
+    // Once the writer is waiting new readers are held back even though only readers hold the lock. Readers get in until
+    // the writer has queued so keep trying until one is refused, giving up eventually so a failure can't hang the test.
+    bool reader_entered = true;
+    std::thread([&]() {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+        while ((reader_entered = lock.TryLockRead()) && std::chrono::steady_clock::now() < deadline) {
+            lock.UnlockRead();
+            std::this_thread::yield();
+        }
+
+        if (reader_entered) {
+            lock.UnlockRead();
+        }
+    }).join();
+    EXPECT_FALSE(reader_entered);
+    EXPECT_FALSE(written);
+
+    lock.UnlockRead();
+    writer.join();
+    EXPECT_TRUE(written);
+}
+
+TEST(readwritelock, exclusion)
+{
+    cRZReadWriteLock lock;
+    const int iterations = 20000;
+    // Volatile so the two halves of each write are separate stores a racing reader could see between.
+    volatile int64_t total = 0;
+    int64_t checked = 0;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 2; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < iterations; ++j) {
+                cRZWriteLock guard(lock);
+                total = total + 1;
+                total = total + 1;
+            }
+        });
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < iterations; ++j) {
+                cRZReadLock guard(lock);
+
+                // Writers only ever leave even totals behind.
+                if (total % 2 != 0) {
+                    ++checked;
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(total, 2 * 2 * iterations);
+    EXPECT_EQ(checked, 0);
+}
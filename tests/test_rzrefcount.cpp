@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <rz/rzrefcount.h>
+#include <rz/rzstring.h>
+#include <thread>
+#include <vector>
+
+TEST(refcount, counting)
+{
+    cRZRefCountMT count;
+
+    EXPECT_EQ(count.AddRef(), 1u);
+    EXPECT_EQ(count.AddRef(), 2u);
+    EXPECT_EQ(count.Release(), 1u);
+    EXPECT_EQ(count.RemoveRef(), 0u);
+    EXPECT_EQ(count.RemoveRef(), 0u);
+    EXPECT_EQ(count.Count(), 0u);
+    EXPECT_EQ(count.ReleaseSigned(), 0u);
+    EXPECT_EQ(count.AddRef(), 0u);
+
+    count.AddRef();
+    cRZRefCountMT copy(count);
+    EXPECT_EQ(copy.Count(), 0u);
+    copy = count;
+    EXPECT_EQ(copy.Count(), 0u);
+}
+
+TEST(refcount, shared_string)
+{
+    const int thread_count = 4;
+    const int iterations = 20000;
+    cRZString *string = new cRZString("shared");
+    string->AddRef();
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < iterations; ++j) {
+                string->AddRef();
+                string->Release();
+            }
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(string->AddRef(), 2u);
+    EXPECT_EQ(string->Release(), 1u);
+    EXPECT_EQ(string->Release(), 0u);
+}
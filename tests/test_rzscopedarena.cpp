@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <rz/rzscopedarena.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+TEST(scopedarena, allocate_reset)
+{
+    char buffer[256];
+    cRZScopedArena arena(buffer, sizeof(buffer), 1024);
+
+    void *first = arena.Allocate(10, 1);
+    EXPECT_EQ(first, buffer);
+
+    void *aligned = arena.Allocate(8, 16);
+    EXPECT_EQ(uintptr_t(aligned) % 16, 0u);
+
+    // The most recent allocation can be handed back and reused.
+    arena.Free(aligned, 8);
+    EXPECT_EQ(arena.Allocate(8, 16), aligned);
+
+    // Overflowing the buffer moves on to heap blocks, large requests get a block of their own.
+    char *spill = static_cast<char *>(arena.Allocate(300));
+    EXPECT_TRUE(spill < buffer || spill >= buffer + sizeof(buffer));
+    char *big = static_cast<char *>(arena.Allocate(5000));
+    memset(big, 0xAA, 5000);
+    EXPECT_EQ(static_cast<char *>(arena.Allocate(16)), spill + 304);
+    EXPECT_EQ(arena.BytesAllocated(), 10u + 8u + 300u + 5000u + 16u);
+
+    arena.Reset();
+    EXPECT_EQ(arena.BytesAllocated(), 0u);
+    EXPECT_EQ(arena.Allocate(10, 1), buffer);
+}
+
+TEST(scopedarena, huge_size)
+{
+    char buffer[256];
+    cRZScopedArena arena(buffer, sizeof(buffer), 1024);
+
+    // Leaves the cursor misaligned so the padding has to be accounted for as well.
+    char *first = static_cast<char *>(arena.Allocate(1, 1));
+    EXPECT_EQ(arena.Allocate(SIZE_MAX, 16), nullptr);
+    EXPECT_EQ(arena.Allocate(SIZE_MAX - 8, 16), nullptr);
+    EXPECT_EQ(arena.Allocate(SIZE_MAX - sizeof(buffer), 1), nullptr);
+    EXPECT_EQ(arena.BytesAllocated(), 1u);
+
+    // The failed requests leave the buffer untouched.
+    EXPECT_EQ(static_cast<char *>(arena.Allocate(1, 1)), first + 1);
+}
+
+TEST(scopedarena, containers)
+{
+    cRZScopedArena arena;
+    std::vector<int, cRZArenaAllocator<int>> values(&arena);
+
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+
+    cRZArenaString str("a string long enough to need storage from the arena", &arena);
+    str += str;
+
+    EXPECT_EQ(values[999], 999);
+    EXPECT_EQ(str.size(), 102u);
+    EXPECT_GT(arena.BytesAllocated(), 1000 * sizeof(int));
+
+    // Without an arena the allocator falls back to the fast allocator.
+    std::vector<int, cRZArenaAllocator<int>> heap_values;
+    heap_values.assign(values.begin(), values.end());
+    EXPECT_EQ(heap_values[500], 500);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <rz/rzcasefold.h>
+#include <rz/rzformat.h>
+#include <rz/rzstring.h>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+static std::string Lower(std::string str)
+{
+    for (char &c : str) {
+        c = char(RZFoldCase((unsigned char)c));
+    }
+
+    return str;
+}
+
+TEST(string, case_compare)
+{
+    cRZString str("Textures/Buildings/HOUSE_01.png");
+
+    EXPECT_TRUE(str.IsEqual("textures/buildings/house_01.PNG", false));
+    EXPECT_FALSE(str.IsEqual("textures/buildings/house_01.PNG", true));
+    EXPECT_FALSE(str.IsEqual("textures/buildings/house_01.PN", false));
+    EXPECT_EQ(str.CompareTo("TEXTURES/BUILDINGS/HOUSE_01.PNG", false), 0);
+    EXPECT_LT(str.CompareTo("textures/buildings/house_02.png", false), 0);
+    EXPECT_GT(str.CompareTo("textures/buildings/house_00.png", false), 0);
+    EXPECT_GT(str.CompareTo("textures", false), 0);
+
+    // Characters outside ASCII are compared as they are.
+    EXPECT_FALSE(RZCaseEqual("\xC9", 1, "\xE9", 1));
+    EXPECT_TRUE(RZCaseEqual("[@Z`", 4, "[@z`", 4));
+    EXPECT_FALSE(RZCaseEqual("[", 1, "{", 1));
+}
+
+TEST(string, case_find)
+{
+    // Mix short and long needles so both search strategies and the vector tails are exercised.
+    std::string hay;
+
+    for (int i = 0; i < 300; ++i) {
+        hay += char("abcXYZ_ABCxyz.0"[(i * 7 + i / 13) % 15]);
+    }
+
+    const char *needles[] = { "a", "Z", "c_", "XyZ.", "bcxyz", "xyz.0a", "abcxyz.0ab", "zzzz", "" };
+    std::string lower_hay = Lower(hay);
+
+    for (const char *needle : needles) {
+        std::string lower_needle = Lower(needle);
+
+        for (size_t pos = 0; pos <= hay.size() + 1; pos += 7) {
+            EXPECT_EQ(RZCaseFind(hay.data(), hay.size(), needle, strlen(needle), pos), lower_hay.find(lower_needle, pos));
+            EXPECT_EQ(
+                RZCaseRFind(hay.data(), hay.size(), needle, strlen(needle), pos), lower_hay.rfind(lower_needle, pos));
+        }
+    }
+
+    cRZString str("Some/Path/To/A/File.TXT");
+    EXPECT_EQ(str.Find("path", 0, false), 5);
+    EXPECT_EQ(str.Find("path", 0, true), -1);
+    EXPECT_EQ(str.RFind(cRZString("/a/"), -1, false), 12);
+    EXPECT_EQ(str.RFind(".txt", 10, false), -1);
+}
+
+TEST(string, move)
+{
+    cRZString source("a path that is too long to fit in any small string buffer");
+    const char *storage = source.data();
+    cRZString moved(std::move(source));
+
+    EXPECT_EQ(moved.data(), storage);
+    EXPECT_EQ(moved.Strlen(), 57u);
+
+    cRZString assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.data(), storage);
+    EXPECT_TRUE(std::is_nothrow_move_constructible<cRZString>::value);
+}
+
+TEST(string, sprintf)
+{
+    cRZString str;
+    str.Sprintf("%s=%d", "short", 5);
+    EXPECT_EQ(str, cRZString("short=5"));
+
+    // Longer than the internal stack buffer so the measured second pass is used.
+    std::string long_arg(600, 'x');
+    str.Sprintf("[%s]%d", long_arg.c_str(), 42);
+    EXPECT_EQ(str, cRZString(("[" + long_arg + "]42").c_str()));
+}
+
+TEST(string, format)
+{
+    cRZString str;
+    RZFormatTo(str, "{} {} {} {} {}", 42, -7, 'c', true, cRZString("text"));
+    EXPECT_EQ(str, cRZString("42 -7 c true text"));
+
+    str.clear();
+    RZ_FORMAT_TO(str, "{:08x}|{:X}|{:5}|{:05}|{:.2f}|{:6}|{:.3}|{{}}", 0xBEEFu, 255, 12, -12, 3.14159, "ab", "abcdef");
+    EXPECT_EQ(str, cRZString("0000beef|FF|   12|-0012|3.14|ab    |abc|{}"));
+
+    std::string std_str("value: ");
+    RZFormatTo(std_str, "{} {}", uint64_t(18446744073709551615ull), INT64_MIN);
+    EXPECT_EQ(std_str, "value: 18446744073709551615 -9223372036854775808");
+}
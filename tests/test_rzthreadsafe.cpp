@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <rz/rzthreadsafe.h>
+#include <thread>
+#include <vector>
+
+TEST(threadsafe, exchange)
+{
+    int first = 0;
+    int second = 0;
+    void *volatile ptr = &first;
+
+    EXPECT_EQ(RZThreadSafeExchange(ptr, &second), &first);
+    EXPECT_EQ(ptr, &second);
+
+    volatile uint32_t value = 5;
+    EXPECT_EQ(RZThreadSafeAdd(value, 3), 8u);
+    EXPECT_EQ(value, 8u);
+}
+
+TEST(threadsafe, atomic_operations)
+{
+    cRZAtomic<uint32_t> value;
+    EXPECT_EQ(value.Load(kRZMemoryOrderRelaxed), 0u);
+
+    value.Store(0xF0, kRZMemoryOrderRelease);
+    EXPECT_EQ(value.Load(kRZMemoryOrderAcquire), 0xF0u);
+    EXPECT_EQ(value.FetchOr(0x0F, kRZMemoryOrderAcqRel), 0xF0u);
+    EXPECT_EQ(value.FetchAnd(0x3C), 0xFFu);
+    EXPECT_EQ(value.FetchXor(0xFF), 0x3Cu);
+    EXPECT_EQ(value.FetchAdd(2, kRZMemoryOrderRelaxed), 0xC3u);
+    EXPECT_EQ(value.FetchSub(5), 0xC5u);
+    EXPECT_EQ(value.Exchange(7), 0xC0u);
+
+    uint32_t expected = 6;
+    EXPECT_FALSE(value.CompareExchange(expected, 9, kRZMemoryOrderAcquire));
+    EXPECT_EQ(expected, 7u);
+    EXPECT_TRUE(value.CompareExchange(expected, 9, kRZMemoryOrderAcqRel));
+    EXPECT_EQ(value.Load(), 9u);
+
+    int object = 0;
+    cRZAtomic<int *> ptr(nullptr);
+    int *expected_ptr = nullptr;
+    EXPECT_TRUE(ptr.CompareExchange(expected_ptr, &object, kRZMemoryOrderRelease));
+    EXPECT_EQ(ptr.Load(kRZMemoryOrderAcquire), &object);
+    EXPECT_EQ(ptr.Exchange(nullptr), &object);
+}
+
+TEST(threadsafe, atomic_threads)
+{
+    const int thread_count = 4;
+    const int iterations = 20000;
+    cRZAtomic<uint32_t> counter(0);
+    cRZAtomic<uint32_t> bits(0);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i]() {
+            for (int j = 0; j < iterations; ++j) {
+                uint32_t current = counter.Load(kRZMemoryOrderRelaxed);
+
+                while (!counter.CompareExchangeWeak(current, current + 1, kRZMemoryOrderRelaxed)) {
+                }
+            }
+
+            bits.FetchOr(1u << i, kRZMemoryOrderRelease);
+        });
+    }
+
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.Load(), uint32_t(thread_count * iterations));
+    EXPECT_EQ(bits.Load(kRZMemoryOrderAcquire), (1u << thread_count) - 1);
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <rz/rzstring.h>
+#include <rz/rzunicodestring.h>
+#include <string>
+
+TEST(unicodestring, transcode)
+{
+    // Long ASCII runs either side of multi byte sequences so both the vector and scalar paths are used.
+    std::string utf8 = "The quick brown fox jumps over the lazy dog. ";
+    utf8 += "Gr\xC3\xBC\xC3\x9F" "e \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80";
+    utf8 += " and back to plain ASCII text again.";
+    cRZString source(utf8.c_str());
+    cRZUnicodeString wide(source);
+
+    EXPECT_EQ(wide[45], u'G');
+    EXPECT_EQ(wide[47], unichar_t(0xFC));
+    EXPECT_EQ(wide[48], unichar_t(0xDF));
+    EXPECT_EQ(wide[51], unichar_t(0x41F));
+    EXPECT_EQ(wide[58], unichar_t(0x65E5));
+    EXPECT_EQ(wide[61], unichar_t(0xD83D));
+    EXPECT_EQ(wide[62], unichar_t(0xDE00));
+
+    cRZString round_trip;
+    wide.ToUTF8(round_trip);
+    EXPECT_EQ(round_trip, source);
+
+    // Malformed input is replaced rather than dropped.
+    cRZUnicodeString bad;
+    bad.FromUTF8("a\xC0\x80" "b\xE6\x97" "c\xFF", 8);
+    const unichar_t expected[] = { u'a', 0xFFFD, 0xFFFD, u'b', 0xFFFD, u'c', 0xFFFD };
+    EXPECT_EQ(bad, cRZUnicodeString(expected, 7));
+
+    const unichar_t lone[] = { u'x', 0xDC00, u'y' };
+    cRZUnicodeString(lone, 3).ToUTF8(round_trip);
+    EXPECT_EQ(round_trip, cRZString("x\xEF\xBF\xBDy"));
+}
+
+TEST(unicodestring, case_compare)
+{
+    // Latin-1, Greek and Cyrillic letters.
+    cRZUnicodeString upper(cRZString("\xC3\x85SA \xCE\xA3\xCE\x9F\xCE\xA6\xCE\x99\xCE\x91 "
+                                     "\xD0\x9C\xD0\x9E\xD0\xA1\xD0\x9A\xD0\x92\xD0\x90"));
+    cRZUnicodeString lower(cRZString("\xC3\xA5sa \xCF\x83\xCE\xBF\xCF\x86\xCE\xB9\xCE\xB1 "
+                                     "\xD0\xBC\xD0\xBE\xD1\x81\xD0\xBA\xD0\xB2\xD0\xB0"));
+
+    EXPECT_TRUE(upper.IsEqual(lower, false));
+    EXPECT_FALSE(upper.IsEqual(lower, true));
+    EXPECT_LT(upper.CompareTo(lower, true), 0);
+
+    upper.MakeLower();
+    EXPECT_EQ(upper, lower);
+
+    const unichar_t mixed[] = { 0x106, u'm', u'a', 0 };
+    const unichar_t swapped[] = { 0x107, u'M', u'A', 0 };
+    EXPECT_EQ(u_strcasecmp(mixed, swapped, U_COMPARE_CODE_POINT_ORDER), 0);
+    EXPECT_EQ(u_strlen(mixed), 3u);
+}
+
+TEST(unicodestring, make_lower)
+{
+    // Final sigma, micro sign and long s are already lower case and must survive, capitals still convert.
+    const unichar_t source[] = { 0x3C2, 0xB5, 0x17F, 0x3A3, 0x106, u'Q' };
+    const unichar_t expected[] = { 0x3C2, 0xB5, 0x17F, 0x3C3, 0x107, u'q' };
+    cRZUnicodeString text(source, 6);
+
+    text.MakeLower();
+    EXPECT_EQ(text, cRZUnicodeString(expected, 6));
+    EXPECT_EQ(RZUnicodeFoldCase(0x3C2), unichar_t(0x3C3));
+}